@@ -0,0 +1,193 @@
+#include "./binaryconversion.h"
+
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define CONVERSION_UTILITIES_X86_SIMD
+# include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace ConversionUtilities
+{
+
+/// \cond
+
+namespace {
+
+typedef void (*SwapFunction)(const char *input, char *output, size_t count);
+
+/*!
+ * \brief Copies \a count values of the specified \a Type from \a input to \a output swapping their byte order one by one.
+ * \remarks \a input and \a output might be equal (but must not overlap otherwise).
+ */
+template<typename Type>
+void swapBytesScalar(const char *input, char *output, size_t count)
+{
+    Type value;
+    for(const char *end = input + count * sizeof(Type); input != end; input += sizeof(Type), output += sizeof(Type)) {
+        memcpy(&value, input, sizeof(Type));
+        value = swapOrder(value);
+        memcpy(output, &value, sizeof(Type));
+    }
+}
+
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+
+/*!
+ * \brief Returns the mask for pshufb which reverses the bytes of each \a width sized value within a 128-bit lane.
+ */
+template<size_t width>
+inline void makeShuffleMask(char *mask)
+{
+    for(size_t i = 0; i != 16; ++i) {
+        mask[i] = static_cast<char>((i / width) * width + (width - 1 - i % width));
+    }
+}
+
+/*!
+ * \brief Swaps the byte order of 16-bit values using SSE2 shifts.
+ */
+__attribute__((target("sse2"))) void swapBytes16Sse2(const char *input, char *output, size_t count)
+{
+    const char *i = input;
+    char *o = output;
+    for(const char *end = input + (count & ~static_cast<size_t>(7)) * 2; i != end; i += 16, o += 16) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(o), _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8)));
+    }
+    swapBytesScalar<uint16>(i, o, count & 7);
+}
+
+/*!
+ * \brief Swaps the byte order of values of the specified \a Type using SSSE3 shuffles.
+ */
+template<typename Type>
+__attribute__((target("ssse3"))) void swapBytesSsse3(const char *input, char *output, size_t count)
+{
+    static const size_t valuesPerVector = 16 / sizeof(Type);
+    char maskBytes[16];
+    makeShuffleMask<sizeof(Type)>(maskBytes);
+    const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(maskBytes));
+    const char *i = input;
+    char *o = output;
+    for(const char *end = input + (count - count % valuesPerVector) * sizeof(Type); i != end; i += 16, o += 16) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(o), _mm_shuffle_epi8(value, mask));
+    }
+    swapBytesScalar<Type>(i, o, count % valuesPerVector);
+}
+
+/*!
+ * \brief Swaps the byte order of values of the specified \a Type using AVX2 shuffles.
+ */
+template<typename Type>
+__attribute__((target("avx2"))) void swapBytesAvx2(const char *input, char *output, size_t count)
+{
+    static const size_t valuesPerVector = 32 / sizeof(Type);
+    char maskBytes[32];
+    makeShuffleMask<sizeof(Type)>(maskBytes);
+    makeShuffleMask<sizeof(Type)>(maskBytes + 16);
+    const __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(maskBytes));
+    const char *i = input;
+    char *o = output;
+    for(const char *end = input + (count - count % valuesPerVector) * sizeof(Type); i != end; i += 32, o += 32) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(o), _mm256_shuffle_epi8(value, mask));
+    }
+    swapBytesScalar<Type>(i, o, count % valuesPerVector);
+}
+
+#endif
+
+/*!
+ * \brief Returns the fastest implementation to swap the byte order of values of the specified \a Type
+ *        supported by the CPU.
+ */
+template<typename Type>
+SwapFunction selectSwapFunction()
+{
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        return &swapBytesAvx2<Type>;
+    }
+    if(__builtin_cpu_supports("ssse3")) {
+        return &swapBytesSsse3<Type>;
+    }
+    if(sizeof(Type) == 2 && __builtin_cpu_supports("sse2")) {
+        return &swapBytes16Sse2;
+    }
+#endif
+    return &swapBytesScalar<Type>;
+}
+
+}
+
+/// \endcond
+
+/*!
+ * \brief Swaps the byte order of the specified 16-bit unsigned integers in-place.
+ * \remarks Uses SIMD instructions if supported by the CPU (determined at runtime).
+ */
+void swapOrder(uint16 *values, size_t count)
+{
+    swapOrder(reinterpret_cast<const char *>(values), values, count);
+}
+
+/*!
+ * \brief Copies \a count 16-bit unsigned integers from the specified \a bytes to \a values swapping their byte order.
+ * \remarks
+ *  - \a bytes does not need to be aligned. It might be equal to \a values (but must not overlap otherwise).
+ *  - Uses SIMD instructions if supported by the CPU (determined at runtime).
+ */
+void swapOrder(const char *bytes, uint16 *values, size_t count)
+{
+    static const SwapFunction swapBytes = selectSwapFunction<uint16>();
+    swapBytes(bytes, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified 32-bit unsigned integers in-place.
+ * \remarks Uses SIMD instructions if supported by the CPU (determined at runtime).
+ */
+void swapOrder(uint32 *values, size_t count)
+{
+    swapOrder(reinterpret_cast<const char *>(values), values, count);
+}
+
+/*!
+ * \brief Copies \a count 32-bit unsigned integers from the specified \a bytes to \a values swapping their byte order.
+ * \remarks
+ *  - \a bytes does not need to be aligned. It might be equal to \a values (but must not overlap otherwise).
+ *  - Uses SIMD instructions if supported by the CPU (determined at runtime).
+ */
+void swapOrder(const char *bytes, uint32 *values, size_t count)
+{
+    static const SwapFunction swapBytes = selectSwapFunction<uint32>();
+    swapBytes(bytes, reinterpret_cast<char *>(values), count);
+}
+
+/*!
+ * \brief Swaps the byte order of the specified 64-bit unsigned integers in-place.
+ * \remarks Uses SIMD instructions if supported by the CPU (determined at runtime).
+ */
+void swapOrder(uint64 *values, size_t count)
+{
+    swapOrder(reinterpret_cast<const char *>(values), values, count);
+}
+
+/*!
+ * \brief Copies \a count 64-bit unsigned integers from the specified \a bytes to \a values swapping their byte order.
+ * \remarks
+ *  - \a bytes does not need to be aligned. It might be equal to \a values (but must not overlap otherwise).
+ *  - Uses SIMD instructions if supported by the CPU (determined at runtime).
+ */
+void swapOrder(const char *bytes, uint64 *values, size_t count)
+{
+    static const SwapFunction swapBytes = selectSwapFunction<uint64>();
+    swapBytes(bytes, reinterpret_cast<char *>(values), count);
+}
+
+}
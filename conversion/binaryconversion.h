@@ -5,6 +5,10 @@
 
 #include "../global.h"
 
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
 #ifdef __BYTE_ORDER__
 #   if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
 #      define CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN false
@@ -71,6 +75,176 @@
 namespace ConversionUtilities
 {
 
+CPP_UTILITIES_EXPORT void swapOrder(uint16 *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(uint32 *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(uint64 *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(const char *bytes, uint16 *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(const char *bytes, uint32 *values, std::size_t count);
+CPP_UTILITIES_EXPORT void swapOrder(const char *bytes, uint64 *values, std::size_t count);
+
+/*!
+ * \brief Specifies the byte order of binary data.
+ */
+enum class Endianness
+{
+    BigEndian, /**< the most significant byte comes first */
+    LittleEndian /**< the least significant byte comes first */
+};
+
+/*!
+ * \brief Swaps the byte order of the specified 16-bit unsigned integer.
+ * \remarks Uses the byte-swap intrinsic of the compiler (if available) which is constexpr as well.
+ */
+CPP_UTILITIES_EXPORT constexpr uint16 swapOrder(uint16 value)
+{
+#ifdef __GNUC__
+    return __builtin_bswap16(value);
+#else
+    return (value >> 8) | (value << 8);
+#endif
+}
+
+/*!
+ * \brief Swaps the byte order of the specified 32-bit unsigned integer.
+ * \remarks Uses the byte-swap intrinsic of the compiler (if available) which is constexpr as well.
+ */
+CPP_UTILITIES_EXPORT constexpr uint32 swapOrder(uint32 value)
+{
+#ifdef __GNUC__
+    return __builtin_bswap32(value);
+#else
+    return (value >> 24)
+            | ((value & 0x00FF0000) >> 8)
+            | ((value & 0x0000FF00) << 8)
+            | (value << 24);
+#endif
+}
+
+/*!
+ * \brief Swaps the byte order of the specified 64-bit unsigned integer.
+ * \remarks Uses the byte-swap intrinsic of the compiler (if available) which is constexpr as well.
+ */
+CPP_UTILITIES_EXPORT constexpr uint64 swapOrder(uint64 value)
+{
+#ifdef __GNUC__
+    return __builtin_bswap64(value);
+#else
+    return(value >> (7 * 8))
+            | ((value & 0x00FF000000000000) >> (5 * 8))
+            | ((value & 0x0000FF0000000000) >> (3 * 8))
+            | ((value & 0x000000FF00000000) >> (1 * 8))
+            | ((value & 0x00000000FF000000) << (1 * 8))
+            | ((value & 0x0000000000FF0000) << (3 * 8))
+            | ((value & 0x000000000000FF00) << (5 * 8))
+            | ((value) << (7 * 8));
+#endif
+}
+
+/// \cond
+
+namespace Detail {
+
+/*!
+ * \brief Provides the smallest unsigned integer type which is able to hold \a width bytes (at least 16-bit).
+ */
+template<std::size_t width>
+struct UIntOfWidth
+{
+    typedef typename std::conditional<(width <= 2), uint16, typename std::conditional<(width <= 4), uint32, uint64>::type>::type type;
+};
+
+/*!
+ * \brief Provides loading and storing \a width bytes using the specified \a endianness.
+ *
+ * Widths which are a power of two are copied via memcpy() into an integer of the same size which is byte-swapped
+ * if required so the compiler generates a single (unaligned) load/store and a bswap instruction. Other widths
+ * (eg. 24-bit) are split into such parts; copying them into the middle of a wider integer would cause a
+ * store-forwarding stall.
+ */
+template<std::size_t width, Endianness endianness, bool isPowerOfTwo = (width & (width - 1)) == 0>
+struct BitsAccess
+{
+    typedef typename UIntOfWidth<width>::type UInt;
+    static const bool isHostOrder = (endianness == Endianness::BigEndian) == CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN;
+
+    static UInt load(const char *buffer)
+    {
+        UInt bits;
+        std::memcpy(&bits, buffer, sizeof(bits));
+        return isHostOrder ? bits : swapOrder(bits);
+    }
+
+    static void store(UInt bits, char *buffer)
+    {
+        if(!isHostOrder) {
+            bits = swapOrder(bits);
+        }
+        std::memcpy(buffer, &bits, sizeof(bits));
+    }
+};
+
+template<Endianness endianness>
+struct BitsAccess<1, endianness, true>
+{
+    typedef typename UIntOfWidth<1>::type UInt;
+
+    static UInt load(const char *buffer)
+    {
+        return static_cast<byte>(*buffer);
+    }
+
+    static void store(UInt bits, char *buffer)
+    {
+        *buffer = static_cast<char>(bits);
+    }
+};
+
+template<std::size_t width, Endianness endianness>
+struct BitsAccess<width, endianness, false>
+{
+    typedef typename UIntOfWidth<width>::type UInt;
+    static const std::size_t headWidth = width > 4 ? 4 : 2;
+    static const std::size_t tailWidth = width - headWidth;
+    typedef BitsAccess<headWidth, endianness> Head;
+    typedef BitsAccess<tailWidth, endianness> Tail;
+
+    static UInt load(const char *buffer)
+    {
+        const UInt head = Head::load(buffer), tail = Tail::load(buffer + headWidth);
+        return endianness == Endianness::BigEndian
+                ? static_cast<UInt>((head << (8 * tailWidth)) | tail)
+                : static_cast<UInt>(head | (tail << (8 * headWidth)));
+    }
+
+    static void store(UInt bits, char *buffer)
+    {
+        Head::store(static_cast<typename Head::UInt>(endianness == Endianness::BigEndian ? bits >> (8 * tailWidth) : bits), buffer);
+        Tail::store(static_cast<typename Tail::UInt>(endianness == Endianness::BigEndian ? bits : bits >> (8 * headWidth)), buffer + headWidth);
+    }
+};
+
+/*!
+ * \brief Returns the unsigned integer stored in the \a width bytes at \a buffer using the specified \a endianness.
+ */
+template<std::size_t width, Endianness endianness>
+inline typename UIntOfWidth<width>::type loadBits(const char *buffer)
+{
+    return BitsAccess<width, endianness>::load(buffer);
+}
+
+/*!
+ * \brief Stores the \a width least significant bytes of \a bits at \a buffer using the specified \a endianness.
+ */
+template<std::size_t width, Endianness endianness>
+inline void storeBits(typename UIntOfWidth<width>::type bits, char *buffer)
+{
+    BitsAccess<width, endianness>::store(bits, buffer);
+}
+
+}
+
+/// \endcond
+
 /*!
  * \brief Encapsulates binary conversion functions using the big endian byte order.
  * \sa <a href="http://en.wikipedia.org/wiki/Endianness">Endianness - Wikipedia</a>
@@ -82,7 +256,9 @@ namespace BE {
 #elif defined(CONVERSION_UTILITIES_BYTE_ORDER_BIG_ENDIAN)
 #   define CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL 1
 #endif
+#define CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS Endianness::BigEndian
 #include "./binaryconversionprivate.h"
+#undef CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS
 #undef CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL
 
 }
@@ -98,7 +274,9 @@ namespace LE {
 #elif defined(CONVERSION_UTILITIES_BYTE_ORDER_BIG_ENDIAN)
 #   define CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL 0
 #endif
+#define CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS Endianness::LittleEndian
 #include "./binaryconversionprivate.h"
+#undef CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS
 #undef CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL
 
 }
@@ -161,40 +339,6 @@ CPP_UTILITIES_EXPORT constexpr uint32 toNormalInt(uint32 synchsafeInt)
             | ((synchsafeInt & 0x7f000000u) >> 3);
 }
 
-/*!
- * \brief Swaps the byte order of the specified 16-bit unsigned integer.
- */
-CPP_UTILITIES_EXPORT constexpr uint16 swapOrder(uint16 value)
-{
-    return (value >> 8) | (value << 8);
-}
-
-/*!
- * \brief Swaps the byte order of the specified 32-bit unsigned integer.
- */
-CPP_UTILITIES_EXPORT constexpr uint32 swapOrder(uint32 value)
-{
-    return (value >> 24)
-            | ((value & 0x00FF0000) >> 8)
-            | ((value & 0x0000FF00) << 8)
-            | (value << 24);
-}
-
-/*!
- * \brief Swaps the byte order of the specified 64-bit unsigned integer.
- */
-CPP_UTILITIES_EXPORT constexpr uint64 swapOrder(uint64 value)
-{
-    return(value >> (7 * 8))
-            | ((value & 0x00FF000000000000) >> (5 * 8))
-            | ((value & 0x0000FF0000000000) >> (3 * 8))
-            | ((value & 0x000000FF00000000) >> (1 * 8))
-            | ((value & 0x00000000FF000000) << (1 * 8))
-            | ((value & 0x0000000000FF0000) << (3 * 8))
-            | ((value & 0x000000000000FF00) << (5 * 8))
-            | ((value) << (7 * 8));
-}
-
 }
 
 #endif // CONVERSION_UTILITIES_BINARY_CONVERSION_H
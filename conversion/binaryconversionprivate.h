@@ -11,13 +11,7 @@
  */
 CPP_UTILITIES_EXPORT inline int16 toInt16(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    return    (static_cast<int16>(value[0]) << 8 & 0xFF00)
-            | (static_cast<int16>(value[1])      & 0x00FF);
-#else
-    return    (static_cast<int16>(value[1]) << 8 & 0xFF00)
-            | (static_cast<int16>(value[0])      & 0x00FF);
-#endif
+    return static_cast<int16>(Detail::loadBits<2, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
 }
 
 /*!
@@ -25,31 +19,16 @@ CPP_UTILITIES_EXPORT inline int16 toInt16(const char *value)
  */
 CPP_UTILITIES_EXPORT inline uint16 toUInt16(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    return    (static_cast<uint16>(value[0]) << 8 & 0xFF00)
-            | (static_cast<uint16>(value[1])      & 0x00FF);
-#else
-    return    (static_cast<uint16>(value[1]) << 8 & 0xFF00)
-            | (static_cast<uint16>(value[0])      & 0x00FF);
-#endif
+    return static_cast<uint16>(Detail::loadBits<2, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
 }
 
 /*!
- * \brief Returns a 32-bit signed integer converted from four bytes at a specified position in a char array.
+ * \brief Returns a 32-bit signed integer converted from three bytes at a specified position in a char array.
+ * \remarks The value is sign-extended.
  */
-CPP_UTILITIES_EXPORT inline int32 toInt32(const char *value)
+CPP_UTILITIES_EXPORT inline int32 toInt24(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    return    (static_cast<int32>(value[0]) << 24 & 0xFF000000)
-            | (static_cast<int32>(value[1]) << 16 & 0x00FF0000)
-            | (static_cast<int32>(value[2]) <<  8 & 0x0000FF00)
-            | (static_cast<int32>(value[3])       & 0x000000FF);
-#else
-    return    (static_cast<int32>(value[3]) << 24 & 0xFF000000)
-            | (static_cast<int32>(value[2]) << 16 & 0x00FF0000)
-            | (static_cast<int32>(value[1]) <<  8 & 0x0000FF00)
-            | (static_cast<int32>(value[0])       & 0x000000FF);
-#endif
+    return static_cast<int32>(static_cast<uint32>(Detail::loadBits<3, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value)) << 8) >> 8;
 }
 
 /*!
@@ -57,15 +36,15 @@ CPP_UTILITIES_EXPORT inline int32 toInt32(const char *value)
  */
 CPP_UTILITIES_EXPORT inline uint32 toUInt24(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    return    (static_cast<uint32>(value[0]) << 16 & 0x00FF0000)
-            | (static_cast<uint32>(value[1]) <<  8 & 0x0000FF00)
-            | (static_cast<uint32>(value[2])       & 0x000000FF);
-#else
-    return    (static_cast<uint32>(value[2]) << 16 & 0x00FF0000)
-            | (static_cast<uint32>(value[1]) <<  8 & 0x0000FF00)
-            | (static_cast<uint32>(value[0])       & 0x000000FF);
-#endif
+    return static_cast<uint32>(Detail::loadBits<3, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
+}
+
+/*!
+ * \brief Returns a 32-bit signed integer converted from four bytes at a specified position in a char array.
+ */
+CPP_UTILITIES_EXPORT inline int32 toInt32(const char *value)
+{
+    return static_cast<int32>(Detail::loadBits<4, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
 }
 
 /*!
@@ -73,17 +52,41 @@ CPP_UTILITIES_EXPORT inline uint32 toUInt24(const char *value)
  */
 CPP_UTILITIES_EXPORT inline uint32 toUInt32(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    return    (static_cast<uint32>(value[0]) << 24 & 0xFF000000)
-            | (static_cast<uint32>(value[1]) << 16 & 0x00FF0000)
-            | (static_cast<uint32>(value[2]) <<  8 & 0x0000FF00)
-            | (static_cast<uint32>(value[3])       & 0x000000FF);
-#else
-    return    (static_cast<uint32>(value[3]) << 24 & 0xFF000000)
-            | (static_cast<uint32>(value[2]) << 16 & 0x00FF0000)
-            | (static_cast<uint32>(value[1]) <<  8 & 0x0000FF00)
-            | (static_cast<uint32>(value[0])       & 0x000000FF);
-#endif
+    return static_cast<uint32>(Detail::loadBits<4, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
+}
+
+/*!
+ * \brief Returns a 64-bit signed integer converted from five bytes at a specified position in a char array.
+ * \remarks The value is sign-extended.
+ */
+CPP_UTILITIES_EXPORT inline int64 toInt40(const char *value)
+{
+    return static_cast<int64>(static_cast<uint64>(Detail::loadBits<5, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value)) << 24) >> 24;
+}
+
+/*!
+ * \brief Returns a 64-bit unsigned integer converted from five bytes at a specified position in a char array.
+ */
+CPP_UTILITIES_EXPORT inline uint64 toUInt40(const char *value)
+{
+    return static_cast<uint64>(Detail::loadBits<5, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
+}
+
+/*!
+ * \brief Returns a 64-bit signed integer converted from seven bytes at a specified position in a char array.
+ * \remarks The value is sign-extended.
+ */
+CPP_UTILITIES_EXPORT inline int64 toInt56(const char *value)
+{
+    return static_cast<int64>(static_cast<uint64>(Detail::loadBits<7, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value)) << 8) >> 8;
+}
+
+/*!
+ * \brief Returns a 64-bit unsigned integer converted from seven bytes at a specified position in a char array.
+ */
+CPP_UTILITIES_EXPORT inline uint64 toUInt56(const char *value)
+{
+    return static_cast<uint64>(Detail::loadBits<7, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
 }
 
 /*!
@@ -91,25 +94,7 @@ CPP_UTILITIES_EXPORT inline uint32 toUInt32(const char *value)
  */
 CPP_UTILITIES_EXPORT inline int64 toInt64(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    return    (static_cast<int64>(value[0]) << 56 & 0xFF00000000000000)
-            | (static_cast<int64>(value[1]) << 48 & 0x00FF000000000000)
-            | (static_cast<int64>(value[2]) << 40 & 0x0000FF0000000000)
-            | (static_cast<int64>(value[3]) << 32 & 0x000000FF00000000)
-            | (static_cast<int64>(value[4]) << 24 & 0x00000000FF000000)
-            | (static_cast<int64>(value[5]) << 16 & 0x0000000000FF0000)
-            | (static_cast<int64>(value[6]) <<  8 & 0x000000000000FF00)
-            | (static_cast<int64>(value[7])       & 0x00000000000000FF);
-#else
-    return    (static_cast<int64>(value[7]) << 56 & 0xFF00000000000000)
-            | (static_cast<int64>(value[6]) << 48 & 0x00FF000000000000)
-            | (static_cast<int64>(value[5]) << 40 & 0x0000FF0000000000)
-            | (static_cast<int64>(value[4]) << 32 & 0x000000FF00000000)
-            | (static_cast<int64>(value[3]) << 24 & 0x00000000FF000000)
-            | (static_cast<int64>(value[2]) << 16 & 0x0000000000FF0000)
-            | (static_cast<int64>(value[1]) <<  8 & 0x000000000000FF00)
-            | (static_cast<int64>(value[0])       & 0x00000000000000FF);
-#endif
+    return static_cast<int64>(Detail::loadBits<8, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
 }
 
 /*!
@@ -117,25 +102,7 @@ CPP_UTILITIES_EXPORT inline int64 toInt64(const char *value)
  */
 CPP_UTILITIES_EXPORT inline uint64 toUInt64(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    return    (static_cast<uint64>(value[0]) << 56 & 0xFF00000000000000)
-            | (static_cast<uint64>(value[1]) << 48 & 0x00FF000000000000)
-            | (static_cast<uint64>(value[2]) << 40 & 0x0000FF0000000000)
-            | (static_cast<uint64>(value[3]) << 32 & 0x000000FF00000000)
-            | (static_cast<uint64>(value[4]) << 24 & 0x00000000FF000000)
-            | (static_cast<uint64>(value[5]) << 16 & 0x0000000000FF0000)
-            | (static_cast<uint64>(value[6]) <<  8 & 0x000000000000FF00)
-            | (static_cast<uint64>(value[7])       & 0x00000000000000FF);
-#else
-    return    (static_cast<uint64>(value[7]) << 56 & 0xFF00000000000000)
-            | (static_cast<uint64>(value[6]) << 48 & 0x00FF000000000000)
-            | (static_cast<uint64>(value[5]) << 40 & 0x0000FF0000000000)
-            | (static_cast<uint64>(value[4]) << 32 & 0x000000FF00000000)
-            | (static_cast<uint64>(value[3]) << 24 & 0x00000000FF000000)
-            | (static_cast<uint64>(value[2]) << 16 & 0x0000000000FF0000)
-            | (static_cast<uint64>(value[1]) <<  8 & 0x000000000000FF00)
-            | (static_cast<uint64>(value[0])       & 0x00000000000000FF);
-#endif
+    return static_cast<uint64>(Detail::loadBits<8, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(value));
 }
 
 /*!
@@ -143,15 +110,10 @@ CPP_UTILITIES_EXPORT inline uint64 toUInt64(const char *value)
  */
 CPP_UTILITIES_EXPORT inline float32 toFloat32(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    int32 val = toInt32(value);
-    char *c = reinterpret_cast<char *>(&val);
-    return *reinterpret_cast<float32 *>(c);
-#else
-    int32 val = toInt32(value);
-    char *c = reinterpret_cast<char *>(&val);
-    return *reinterpret_cast<float32 *>(c);
-#endif
+    const uint32 bits = toUInt32(value);
+    float32 result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
 }
 
 /*!
@@ -159,15 +121,10 @@ CPP_UTILITIES_EXPORT inline float32 toFloat32(const char *value)
  */
 CPP_UTILITIES_EXPORT inline float64 toFloat64(const char *value)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    int64 val = toInt64(value);
-    char *c = reinterpret_cast<char *>(&val);
-    return *reinterpret_cast<float64*>(c);
-#else
-    int64 val = toInt64(value);
-    char *c = reinterpret_cast<char *>(&val);
-    return *reinterpret_cast<float64 *>(c);
-#endif
+    const uint64 bits = toUInt64(value);
+    float64 result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
 }
 
 /*!
@@ -175,13 +132,7 @@ CPP_UTILITIES_EXPORT inline float64 toFloat64(const char *value)
  */
 CPP_UTILITIES_EXPORT inline void getBytes(int16 value, char *outputbuffer)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    outputbuffer[0] = static_cast<char>((value >> 8) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value     ) & 0xFF);
-#else
-    outputbuffer[1] = static_cast<char>((value >> 8) & 0xFF);
-    outputbuffer[0] = static_cast<char>((value     ) & 0xFF);
-#endif
+    Detail::storeBits<2, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint16>(value), outputbuffer);
 }
 
 /*!
@@ -189,13 +140,7 @@ CPP_UTILITIES_EXPORT inline void getBytes(int16 value, char *outputbuffer)
  */
 CPP_UTILITIES_EXPORT inline void getBytes(uint16 value, char *outputbuffer)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    outputbuffer[0] = static_cast<char>((value >> 8) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value     ) & 0xFF);
-#else
-    outputbuffer[1] = static_cast<char>((value >> 8) & 0xFF);
-    outputbuffer[0] = static_cast<char>((value     ) & 0xFF);
-#endif
+    Detail::storeBits<2, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint16>(value), outputbuffer);
 }
 
 /*!
@@ -204,15 +149,7 @@ CPP_UTILITIES_EXPORT inline void getBytes(uint16 value, char *outputbuffer)
  */
 CPP_UTILITIES_EXPORT inline void getBytes24(uint32 value, char *outputbuffer)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    outputbuffer[0] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value      ) & 0xFF);
-#else
-    outputbuffer[2] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[0] = static_cast<char>((value      ) & 0xFF);
-#endif
+    Detail::storeBits<3, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint32>(value), outputbuffer);
 }
 
 /*!
@@ -220,35 +157,33 @@ CPP_UTILITIES_EXPORT inline void getBytes24(uint32 value, char *outputbuffer)
  */
 CPP_UTILITIES_EXPORT inline void getBytes(int32 value, char *outputbuffer)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    outputbuffer[0] = static_cast<char>((value >> 24) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[3] = static_cast<char>((value      ) & 0xFF);
-#else
-    outputbuffer[3] = static_cast<char>((value >> 24) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[0] = static_cast<char>((value      ) & 0xFF);
-#endif
+    Detail::storeBits<4, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint32>(value), outputbuffer);
 }
 
 /*!
- * \brief Stores the specified 32-bit signed integer value at a specified position in a char array.
+ * \brief Stores the specified 32-bit unsigned integer value at a specified position in a char array.
  */
 CPP_UTILITIES_EXPORT inline void getBytes(uint32 value, char *outputbuffer)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    outputbuffer[0] = static_cast<char>((value >> 24) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[3] = static_cast<char>((value      ) & 0xFF);
-#else
-    outputbuffer[3] = static_cast<char>((value >> 24) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[0] = static_cast<char>((value      ) & 0xFF);
-#endif
+    Detail::storeBits<4, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint32>(value), outputbuffer);
+}
+
+/*!
+ * \brief Stores the specified 40-bit unsigned integer value at a specified position in a char array.
+ * \remarks Ignores the three most significant bytes.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes40(uint64 value, char *outputbuffer)
+{
+    Detail::storeBits<5, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint64>(value), outputbuffer);
+}
+
+/*!
+ * \brief Stores the specified 56-bit unsigned integer value at a specified position in a char array.
+ * \remarks Ignores the most significant byte.
+ */
+CPP_UTILITIES_EXPORT inline void getBytes56(uint64 value, char *outputbuffer)
+{
+    Detail::storeBits<7, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint64>(value), outputbuffer);
 }
 
 /*!
@@ -256,25 +191,7 @@ CPP_UTILITIES_EXPORT inline void getBytes(uint32 value, char *outputbuffer)
  */
 CPP_UTILITIES_EXPORT inline void getBytes(int64 value, char *outputbuffer)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    outputbuffer[0] = static_cast<char>((value >> 56) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >> 48) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value >> 40) & 0xFF);
-    outputbuffer[3] = static_cast<char>((value >> 32) & 0xFF);
-    outputbuffer[4] = static_cast<char>((value >> 24) & 0xFF);
-    outputbuffer[5] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[6] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[7] = static_cast<char>((value      ) & 0xFF);
-#else
-    outputbuffer[7] = static_cast<char>((value >> 56) & 0xFF);
-    outputbuffer[6] = static_cast<char>((value >> 48) & 0xFF);
-    outputbuffer[5] = static_cast<char>((value >> 40) & 0xFF);
-    outputbuffer[4] = static_cast<char>((value >> 32) & 0xFF);
-    outputbuffer[3] = static_cast<char>((value >> 24) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[0] = static_cast<char>((value      ) & 0xFF);
-#endif
+    Detail::storeBits<8, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint64>(value), outputbuffer);
 }
 
 /*!
@@ -282,25 +199,7 @@ CPP_UTILITIES_EXPORT inline void getBytes(int64 value, char *outputbuffer)
  */
 CPP_UTILITIES_EXPORT inline void getBytes(uint64 value, char *outputbuffer)
 {
-#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
-    outputbuffer[0] = static_cast<char>((value >> 56) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >> 48) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value >> 40) & 0xFF);
-    outputbuffer[3] = static_cast<char>((value >> 32) & 0xFF);
-    outputbuffer[4] = static_cast<char>((value >> 24) & 0xFF);
-    outputbuffer[5] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[6] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[7] = static_cast<char>((value      ) & 0xFF);
-#else
-    outputbuffer[7] = static_cast<char>((value >> 56) & 0xFF);
-    outputbuffer[6] = static_cast<char>((value >> 48) & 0xFF);
-    outputbuffer[5] = static_cast<char>((value >> 40) & 0xFF);
-    outputbuffer[4] = static_cast<char>((value >> 32) & 0xFF);
-    outputbuffer[3] = static_cast<char>((value >> 24) & 0xFF);
-    outputbuffer[2] = static_cast<char>((value >> 16) & 0xFF);
-    outputbuffer[1] = static_cast<char>((value >>  8) & 0xFF);
-    outputbuffer[0] = static_cast<char>((value      ) & 0xFF);
-#endif
+    Detail::storeBits<8, CONVERSION_UTILITIES_BINARY_CONVERSION_ENDIANNESS>(static_cast<uint64>(value), outputbuffer);
 }
 
 /*!
@@ -308,9 +207,9 @@ CPP_UTILITIES_EXPORT inline void getBytes(uint64 value, char *outputbuffer)
  */
 CPP_UTILITIES_EXPORT inline void getBytes(float32 value, char *outputbuffer)
 {
-    char *c = reinterpret_cast<char *>(&value);
-    int32 i = *reinterpret_cast<int32 *>(c);
-    getBytes(i, outputbuffer);
+    uint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    getBytes(bits, outputbuffer);
 }
 
 /*!
@@ -318,9 +217,54 @@ CPP_UTILITIES_EXPORT inline void getBytes(float32 value, char *outputbuffer)
  */
 CPP_UTILITIES_EXPORT inline void getBytes(float64 value, char *outputbuffer)
 {
-    char *c = reinterpret_cast<char *>(&value);
-    int64 i = *reinterpret_cast<int64 *>(c);
-    getBytes(i, outputbuffer);
+    uint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    getBytes(bits, outputbuffer);
+}
+
+/*!
+ * \brief Converts the specified 16-bit \a values between the host byte order and the byte order
+ *        of the enclosing namespace in-place.
+ * \remarks The conversion is symmetric so this function can be used to decode and encode.
+ */
+CPP_UTILITIES_EXPORT inline void convertByteOrder(uint16 *values, std::size_t count)
+{
+#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
+    swapOrder(values, count);
+#else
+    VAR_UNUSED(values)
+    VAR_UNUSED(count)
+#endif
+}
+
+/*!
+ * \brief Converts the specified 32-bit \a values between the host byte order and the byte order
+ *        of the enclosing namespace in-place.
+ * \remarks The conversion is symmetric so this function can be used to decode and encode.
+ */
+CPP_UTILITIES_EXPORT inline void convertByteOrder(uint32 *values, std::size_t count)
+{
+#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
+    swapOrder(values, count);
+#else
+    VAR_UNUSED(values)
+    VAR_UNUSED(count)
+#endif
+}
+
+/*!
+ * \brief Converts the specified 64-bit \a values between the host byte order and the byte order
+ *        of the enclosing namespace in-place.
+ * \remarks The conversion is symmetric so this function can be used to decode and encode.
+ */
+CPP_UTILITIES_EXPORT inline void convertByteOrder(uint64 *values, std::size_t count)
+{
+#if CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL == 0
+    swapOrder(values, count);
+#else
+    VAR_UNUSED(values)
+    VAR_UNUSED(count)
+#endif
 }
 
 #endif // CONVERSION_UTILITIES_BINARY_CONVERSION_INTERNAL
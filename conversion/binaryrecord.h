@@ -0,0 +1,250 @@
+#ifndef CONVERSION_UTILITIES_BINARY_RECORD_H
+#define CONVERSION_UTILITIES_BINARY_RECORD_H
+
+#include "./binaryconversion.h"
+
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+namespace ConversionUtilities {
+
+/// \cond
+
+namespace Detail {
+
+template<std::size_t... indices>
+struct IndexSequence {};
+
+template<std::size_t count, std::size_t... indices>
+struct MakeIndexSequence : MakeIndexSequence<count - 1, count - 1, indices...> {};
+
+template<std::size_t... indices>
+struct MakeIndexSequence<0, indices...>
+{
+    typedef IndexSequence<indices...> type;
+};
+
+template<typename... Fields>
+struct RecordSize : std::integral_constant<std::size_t, 0> {};
+
+template<typename First, typename... Rest>
+struct RecordSize<First, Rest...> : std::integral_constant<std::size_t, First::width + RecordSize<Rest...>::value> {};
+
+template<std::size_t index, typename... Fields>
+struct RecordFieldOffset;
+
+template<typename First, typename... Rest>
+struct RecordFieldOffset<0, First, Rest...> : std::integral_constant<std::size_t, 0> {};
+
+template<std::size_t index, typename First, typename... Rest>
+struct RecordFieldOffset<index, First, Rest...> : std::integral_constant<std::size_t, First::width + RecordFieldOffset<index - 1, Rest...>::value> {};
+
+template<typename T, std::size_t width>
+inline T fromBits(uint64 bits, std::false_type)
+{
+    static const int unusedBits = 64 - 8 * width;
+    return std::is_signed<T>::value && unusedBits
+            ? static_cast<T>(static_cast<int64>(bits << unusedBits) >> unusedBits)
+            : static_cast<T>(bits);
+}
+
+template<typename T, std::size_t width>
+inline T fromBits(uint64 bits, std::true_type)
+{
+    typedef typename std::conditional<sizeof(T) == sizeof(uint32), uint32, uint64>::type BitsType;
+    const BitsType sizedBits = static_cast<BitsType>(bits);
+    T value;
+    std::memcpy(&value, &sizedBits, sizeof(T));
+    return value;
+}
+
+template<typename T>
+inline uint64 toBits(T value, std::false_type)
+{
+    return static_cast<uint64>(value);
+}
+
+template<typename T>
+inline uint64 toBits(T value, std::true_type)
+{
+    typename std::conditional<sizeof(T) == sizeof(uint32), uint32, uint64>::type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+}
+
+/// \endcond
+
+/*!
+ * \brief The RecordField struct describes a field of a BinaryRecord.
+ * \tparam T Specifies the type the field is decoded to (an integral type, an enum, float32 or float64).
+ * \tparam endianness Specifies the byte order of the field.
+ * \tparam fieldWidth Specifies the number of bytes the field occupies (1 to 8). Signed integers which occupy less bytes
+ *                    than their type are sign-extended (eg. 24-bit integers). Floating point numbers must occupy
+ *                    exactly the size of their type.
+ */
+template<typename T, Endianness endianness, std::size_t fieldWidth = sizeof(T)>
+struct RecordField
+{
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value || std::is_floating_point<T>::value, "type not supported");
+    static_assert(fieldWidth >= 1 && fieldWidth <= 8, "width must be between 1 and 8 bytes");
+    static_assert(!std::is_floating_point<T>::value || fieldWidth == sizeof(T), "width of floating point fields must match their size");
+
+    typedef T ValueType;
+    static constexpr std::size_t width = fieldWidth;
+
+    static T decode(const char *buffer);
+    static void encode(T value, char *buffer);
+};
+
+template<typename T, Endianness endianness, std::size_t fieldWidth>
+constexpr std::size_t RecordField<T, endianness, fieldWidth>::width;
+
+/*!
+ * \brief Returns the value of the field stored at \a buffer.
+ */
+template<typename T, Endianness endianness, std::size_t fieldWidth>
+inline T RecordField<T, endianness, fieldWidth>::decode(const char *buffer)
+{
+    return Detail::fromBits<T, fieldWidth>(Detail::loadBits<fieldWidth, endianness>(buffer), std::is_floating_point<T>());
+}
+
+/*!
+ * \brief Stores the specified \a value at \a buffer.
+ * \remarks Higher bits of integers which do not fit into the width of the field are discarded.
+ */
+template<typename T, Endianness endianness, std::size_t fieldWidth>
+inline void RecordField<T, endianness, fieldWidth>::encode(T value, char *buffer)
+{
+    Detail::storeBits<fieldWidth, endianness>(static_cast<typename Detail::UIntOfWidth<fieldWidth>::type>(Detail::toBits(value, std::is_floating_point<T>())), buffer);
+}
+
+/*!
+ * \brief Describes a big endian field of a BinaryRecord.
+ */
+template<typename T, std::size_t width = sizeof(T)>
+using BEField = RecordField<T, Endianness::BigEndian, width>;
+
+/*!
+ * \brief Describes a little endian field of a BinaryRecord.
+ */
+template<typename T, std::size_t width = sizeof(T)>
+using LEField = RecordField<T, Endianness::LittleEndian, width>;
+
+/*!
+ * \brief The BinaryRecord struct describes a packed record of fixed size as a list of fields.
+ *
+ * The offset of each field is computed at compile-time so decoding a record boils down to a sequence of loads
+ * and byte swaps without any loop or branch:
+ * \code
+ * // the header of a FLAC "STREAMINFO" block
+ * typedef BinaryRecord<BEField<uint16>, BEField<uint16>, BEField<uint32, 3>, BEField<uint32, 3>, BEField<uint64>> StreamInfo;
+ * uint16 minBlockSize, maxBlockSize;
+ * uint32 minFrameSize, maxFrameSize;
+ * uint64 bitFields;
+ * StreamInfo::decode(buffer, std::tie(minBlockSize, maxBlockSize, minFrameSize, maxFrameSize, bitFields));
+ * \endcode
+ *
+ * BinaryReader::readRecord() and BinaryWriter::writeRecord() read/write the whole record at once.
+ *
+ * \tparam Fields Specifies the fields (see RecordField, BEField and LEField). At least one field is required.
+ */
+template<typename... Fields>
+struct BinaryRecord
+{
+    static_assert(sizeof...(Fields) > 0, "A BinaryRecord must consist of at least one field.");
+
+    typedef std::tuple<typename Fields::ValueType...> ValueTuple;
+    static constexpr std::size_t size = Detail::RecordSize<Fields...>::value;
+    static constexpr std::size_t fieldCount = sizeof...(Fields);
+
+    template<std::size_t index> static typename std::tuple_element<index, ValueTuple>::type decodeField(const char *buffer);
+    template<typename Tuple> static void decode(const char *buffer, Tuple &&values);
+    static ValueTuple decode(const char *buffer);
+    template<typename Tuple> static void encode(const Tuple &values, char *buffer);
+
+private:
+    typedef std::tuple<Fields...> FieldTuple;
+    template<typename Tuple, std::size_t... indices> static void decode(const char *buffer, Tuple &values, Detail::IndexSequence<indices...>);
+    template<typename Tuple, std::size_t... indices> static void encode(const Tuple &values, char *buffer, Detail::IndexSequence<indices...>);
+};
+
+template<typename... Fields>
+constexpr std::size_t BinaryRecord<Fields...>::size;
+
+template<typename... Fields>
+constexpr std::size_t BinaryRecord<Fields...>::fieldCount;
+
+/*!
+ * \brief Returns the value of the field with the specified \a index from the record stored at \a buffer.
+ */
+template<typename... Fields>
+template<std::size_t index>
+inline typename std::tuple_element<index, typename BinaryRecord<Fields...>::ValueTuple>::type BinaryRecord<Fields...>::decodeField(const char *buffer)
+{
+    return std::tuple_element<index, FieldTuple>::type::decode(buffer + Detail::RecordFieldOffset<index, Fields...>::value);
+}
+
+/*!
+ * \brief Decodes the record stored at \a buffer (which must hold at least \a size bytes) into \a values.
+ * \param values Specifies a tuple with one element per field, eg. a ValueTuple or a tuple of references
+ *               created via std::tie() to decode the fields directly into existing variables.
+ */
+template<typename... Fields>
+template<typename Tuple>
+inline void BinaryRecord<Fields...>::decode(const char *buffer, Tuple &&values)
+{
+    static_assert(std::tuple_size<typename std::remove_reference<Tuple>::type>::value == sizeof...(Fields), "number of values must match the number of fields");
+    decode(buffer, values, typename Detail::MakeIndexSequence<sizeof...(Fields)>::type());
+}
+
+/*!
+ * \brief Returns the values of the record stored at \a buffer (which must hold at least \a size bytes).
+ */
+template<typename... Fields>
+inline typename BinaryRecord<Fields...>::ValueTuple BinaryRecord<Fields...>::decode(const char *buffer)
+{
+    ValueTuple values;
+    decode(buffer, values);
+    return values;
+}
+
+/*!
+ * \brief Encodes the specified \a values into \a buffer (which must hold at least \a size bytes).
+ * \param values Specifies a tuple with one element per field, eg. a ValueTuple or a tuple of references
+ *               created via std::tie().
+ */
+template<typename... Fields>
+template<typename Tuple>
+inline void BinaryRecord<Fields...>::encode(const Tuple &values, char *buffer)
+{
+    static_assert(std::tuple_size<Tuple>::value == sizeof...(Fields), "number of values must match the number of fields");
+    encode(values, buffer, typename Detail::MakeIndexSequence<sizeof...(Fields)>::type());
+}
+
+/// \cond
+
+template<typename... Fields>
+template<typename Tuple, std::size_t... indices>
+inline void BinaryRecord<Fields...>::decode(const char *buffer, Tuple &values, Detail::IndexSequence<indices...>)
+{
+    const int expansion[] = { 0, (std::get<indices>(values) = decodeField<indices>(buffer), 0)... };
+    VAR_UNUSED(expansion)
+}
+
+template<typename... Fields>
+template<typename Tuple, std::size_t... indices>
+inline void BinaryRecord<Fields...>::encode(const Tuple &values, char *buffer, Detail::IndexSequence<indices...>)
+{
+    const int expansion[] = { 0, (std::tuple_element<indices, FieldTuple>::type::encode(std::get<indices>(values), buffer + Detail::RecordFieldOffset<indices, Fields...>::value), 0)... };
+    VAR_UNUSED(expansion)
+}
+
+/// \endcond
+
+}
+
+#endif // CONVERSION_UTILITIES_BINARY_RECORD_H
@@ -0,0 +1,194 @@
+#include "./charsetconverter.h"
+#include "./conversionexception.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+
+#include <iconv.h>
+#include <errno.h>
+
+using namespace std;
+
+namespace ConversionUtilities {
+
+/*!
+ * \class ConversionUtilities::CharsetConverter
+ * \brief The CharsetConverter class converts text from one character set to another chunk by chunk.
+ *
+ * In contrast to convertString() the whole input does not need to be in memory and the output is written to a
+ * buffer provided by the caller or to a std::ostream. So the memory usage stays bounded regardless of the size of
+ * the input. A multibyte sequence which is split between two chunks is kept by the converter until the next chunk
+ * is passed:
+ * \code
+ * CharsetConverter converter("SHIFT-JIS", "UTF-8");
+ * char buffer[0x1000];
+ * while(input.read(buffer, sizeof(buffer)) || input.gcount()) {
+ *     converter.convert(buffer, static_cast<size_t>(input.gcount()), output);
+ * }
+ * converter.finish(output);
+ * \endcode
+ *
+ * The conversion is done using iconv so all character sets supported by iconv can be used.
+ *
+ * \remarks The class is not thread-safe. Use one converter per thread.
+ */
+
+/*!
+ * \brief Constructs a new converter for the conversion from \a fromCharset to \a toCharset.
+ * \throws Throws ConversionException if iconv does not support the conversion.
+ */
+CharsetConverter::CharsetConverter(const char *fromCharset, const char *toCharset) :
+    m_descriptor(iconv_open(toCharset, fromCharset)),
+    m_pendingInputSize(0)
+{
+    if(m_descriptor == reinterpret_cast<iconv_t>(-1)) {
+        throw ConversionException("Unable to allocate descriptor for character set conversion.");
+    }
+}
+
+/*!
+ * \brief Destroys the converter.
+ */
+CharsetConverter::~CharsetConverter()
+{
+    iconv_close(static_cast<iconv_t>(m_descriptor));
+}
+
+/*!
+ * \brief Converts the input within \a input and \a inputEnd storing the result within \a output and \a outputEnd.
+ *
+ * The conversion stops when the output buffer is full, when an invalid sequence is encountered or when the input
+ * has been consumed. An incomplete sequence at the end of the input is kept and completed with the first bytes of
+ * the next chunk.
+ *
+ * \param input Specifies the start of the input. It is advanced to the first byte which has not been consumed. So
+ *              it only differs from \a inputEnd if the output buffer is full or an invalid sequence has been
+ *              encountered. In both cases, convert() should be called again with the remaining input (and an
+ *              emptied output buffer).
+ * \param output Specifies the output buffer. It must be large enough to hold at least one converted character.
+ * \returns Returns the end of the output.
+ * \throws Throws ConversionException if \a input starts with an invalid sequence or the output buffer is too small
+ *         to hold the next character. An invalid sequence in the middle of the input is only reported by the next
+ *         call so the output converted up to that point is not lost.
+ */
+char *CharsetConverter::convert(const char *&input, const char *inputEnd, char *output, char *outputEnd)
+{
+    const iconv_t descriptor = static_cast<iconv_t>(m_descriptor);
+    char *outputPos = output;
+    size_t outputBytesLeft = static_cast<size_t>(outputEnd - output);
+
+    // complete the incomplete sequence from the previous chunk first
+    if(m_pendingInputSize) {
+        const size_t previouslyPending = m_pendingInputSize;
+        const size_t appended = min(sizeof(m_pendingInput) - previouslyPending, static_cast<size_t>(inputEnd - input));
+        memcpy(m_pendingInput + previouslyPending, input, appended);
+        char *pendingPos = m_pendingInput;
+        size_t pendingBytesLeft = previouslyPending + appended;
+        const bool failed = iconv(descriptor, &pendingPos, &pendingBytesLeft, &outputPos, &outputBytesLeft) == static_cast<size_t>(-1);
+        const int error = errno;
+        const size_t consumed = static_cast<size_t>(pendingPos - m_pendingInput);
+        if(consumed >= previouslyPending) {
+            // the sequence is complete now; errors within the appended bytes will be encountered again when converting the input itself
+            input += consumed - previouslyPending;
+            m_pendingInputSize = 0;
+        } else if(failed && error == EINVAL && input + appended == inputEnd) {
+            // the sequence is still incomplete but the whole chunk has been appended so wait for the next chunk
+            m_pendingInputSize += appended;
+            input = inputEnd;
+            return outputPos;
+        } else if(failed && error == E2BIG) {
+            if(outputPos == output) {
+                throw ConversionException("The output buffer is too small for the next character.");
+            }
+            memmove(m_pendingInput, m_pendingInput + consumed, m_pendingInputSize -= consumed);
+            return outputPos;
+        } else {
+            throw ConversionException("Invalid multibyte sequence in the input.");
+        }
+    }
+
+    // convert the input
+    char *inputPos = const_cast<char *>(input);
+    size_t inputBytesLeft = static_cast<size_t>(inputEnd - input);
+    const bool failed = iconv(descriptor, &inputPos, &inputBytesLeft, &outputPos, &outputBytesLeft) == static_cast<size_t>(-1);
+    const int error = errno;
+    input = inputPos;
+    if(failed) {
+        if(error == EINVAL && inputBytesLeft <= sizeof(m_pendingInput)) {
+            // keep the incomplete sequence at the end of the input until the next chunk is passed
+            memcpy(m_pendingInput, input, inputBytesLeft);
+            m_pendingInputSize = inputBytesLeft;
+            input = inputEnd;
+        } else if(outputPos == output) {
+            if(error == E2BIG) {
+                throw ConversionException("The output buffer is too small for the next character.");
+            }
+            throw ConversionException("Invalid multibyte sequence in the input.");
+        }
+    }
+    return outputPos;
+}
+
+/*!
+ * \brief Converts the specified input and writes the result to the specified \a output stream.
+ *
+ * The result is written in blocks of 4 KiB so no memory is allocated regardless of the \a inputSize.
+ *
+ * \throws Throws ConversionException if the input contains an invalid sequence. The output converted up to that
+ *         point has already been written to \a output in this case.
+ */
+void CharsetConverter::convert(const char *input, std::size_t inputSize, ostream &output)
+{
+    char buffer[0x1000];
+    for(const char *const inputEnd = input + inputSize; input != inputEnd; ) {
+        const char *const bufferEnd = convert(input, inputEnd, buffer, buffer + sizeof(buffer));
+        output.write(buffer, bufferEnd - buffer);
+    }
+}
+
+/*!
+ * \brief Finishes the conversion and resets the converter so it can be used for further conversions.
+ *
+ * If the target character set is stateful (eg. UTF-7 or ISO-2022-JP), the sequence required to return to the
+ * initial state is written to \a output. An incomplete sequence at the end of the last chunk is ignored (like
+ * it is done by convertString()). Use pendingInputSize() before calling this function to detect this case.
+ *
+ * \returns Returns the end of the output or nullptr if the output buffer is too small. In the latter case the
+ *          converter has not been reset.
+ */
+char *CharsetConverter::finish(char *output, char *outputEnd)
+{
+    size_t outputBytesLeft = static_cast<size_t>(outputEnd - output);
+    if(iconv(static_cast<iconv_t>(m_descriptor), nullptr, nullptr, &output, &outputBytesLeft) == static_cast<size_t>(-1)) {
+        return nullptr;
+    }
+    m_pendingInputSize = 0;
+    return output;
+}
+
+/*!
+ * \brief Finishes the conversion writing the final output (if any) to the specified \a output stream.
+ * \sa See finish(char *, char *) for details.
+ */
+void CharsetConverter::finish(ostream &output)
+{
+    char buffer[0x40];
+    const char *const bufferEnd = finish(buffer, buffer + sizeof(buffer));
+    if(!bufferEnd) {
+        throw ConversionException("Unable to return to the initial shift state.");
+    }
+    output.write(buffer, bufferEnd - buffer);
+}
+
+/*!
+ * \brief Resets the converter so it can be used for further conversions discarding any pending input.
+ * \remarks In contrast to finish() nothing is written.
+ */
+void CharsetConverter::reset()
+{
+    iconv(static_cast<iconv_t>(m_descriptor), nullptr, nullptr, nullptr, nullptr);
+    m_pendingInputSize = 0;
+}
+
+}
@@ -0,0 +1,43 @@
+#ifndef CONVERSION_UTILITIES_CHARSETCONVERTER_H
+#define CONVERSION_UTILITIES_CHARSETCONVERTER_H
+
+#include "../global.h"
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace ConversionUtilities {
+
+class CPP_UTILITIES_EXPORT CharsetConverter
+{
+public:
+    CharsetConverter(const char *fromCharset, const char *toCharset);
+    CharsetConverter(const CharsetConverter &other) = delete;
+    ~CharsetConverter();
+    CharsetConverter &operator=(const CharsetConverter &other) = delete;
+
+    char *convert(const char *&input, const char *inputEnd, char *output, char *outputEnd);
+    void convert(const char *input, std::size_t inputSize, std::ostream &output);
+    char *finish(char *output, char *outputEnd);
+    void finish(std::ostream &output);
+    void reset();
+    std::size_t pendingInputSize() const;
+
+private:
+    void *m_descriptor;
+    char m_pendingInput[16];
+    std::size_t m_pendingInputSize;
+};
+
+/*!
+ * \brief Returns the number of bytes of an incomplete sequence at the end of the previous chunk which are
+ *        kept until the next chunk is passed to convert().
+ */
+inline std::size_t CharsetConverter::pendingInputSize() const
+{
+    return m_pendingInputSize;
+}
+
+}
+
+#endif // CONVERSION_UTILITIES_CHARSETCONVERTER_H
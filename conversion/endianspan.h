@@ -0,0 +1,446 @@
+#ifndef CONVERSION_UTILITIES_ENDIAN_SPAN_H
+#define CONVERSION_UTILITIES_ENDIAN_SPAN_H
+
+#include "./binaryrecord.h"
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+namespace ConversionUtilities {
+
+/*!
+ * \brief The EndianSpan class provides a read-only view over an array of values of the specified \a endianness
+ *        stored in a raw (possibly unaligned) byte buffer.
+ *
+ * The values are decoded when accessed so algorithms can work directly on the raw data, eg. on a memory-mapped file:
+ * \code
+ * // find the chunk containing a sample within the big endian "stco"-like table of a file
+ * const BESpan<uint32> chunkOffsets(table, entryCount);
+ * const auto chunk = std::upper_bound(chunkOffsets.begin(), chunkOffsets.end(), sampleOffset) - chunkOffsets.begin();
+ * \endcode
+ *
+ * \tparam T Specifies the type of the values (an integral type, an enum, float32 or float64).
+ * \tparam endianness Specifies the byte order of the values.
+ * \sa BESpan, LESpan
+ */
+template<typename T, Endianness endianness>
+class EndianSpan
+{
+public:
+    class Iterator;
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Iterator const_iterator;
+    typedef Iterator iterator;
+
+    EndianSpan();
+    EndianSpan(const char *data, std::size_t size);
+
+    const char *data() const;
+    std::size_t size() const;
+    std::size_t byteSize() const;
+    bool empty() const;
+    T operator[](std::size_t index) const;
+    T front() const;
+    T back() const;
+    Iterator begin() const;
+    Iterator end() const;
+    EndianSpan subspan(std::size_t offset, std::size_t count) const;
+    void copyTo(T *values) const;
+
+private:
+    typedef RecordField<T, endianness> Field;
+
+    const char *m_data;
+    std::size_t m_size;
+};
+
+/*!
+ * \brief The EndianSpan::Iterator class is a random-access iterator decoding the values on dereference.
+ * \remarks Dereferencing yields the values (not references) so the elements can not be modified.
+ */
+template<typename T, Endianness endianness>
+class EndianSpan<T, endianness>::Iterator
+{
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T *pointer;
+    typedef T reference;
+
+    Iterator();
+    explicit Iterator(const char *position);
+
+    const char *position() const;
+    T operator*() const;
+    T operator[](difference_type offset) const;
+    Iterator &operator++();
+    Iterator operator++(int);
+    Iterator &operator--();
+    Iterator operator--(int);
+    Iterator &operator+=(difference_type offset);
+    Iterator &operator-=(difference_type offset);
+    Iterator operator+(difference_type offset) const;
+    Iterator operator-(difference_type offset) const;
+    difference_type operator-(const Iterator &other) const;
+    bool operator==(const Iterator &other) const;
+    bool operator!=(const Iterator &other) const;
+    bool operator<(const Iterator &other) const;
+    bool operator>(const Iterator &other) const;
+    bool operator<=(const Iterator &other) const;
+    bool operator>=(const Iterator &other) const;
+
+    /*!
+     * \brief Returns an iterator advanced by the specified number of values.
+     */
+    friend Iterator operator+(difference_type offset, const Iterator &iterator)
+    {
+        return iterator + offset;
+    }
+
+private:
+    const char *m_pos;
+};
+
+/*!
+ * \brief A view over big endian values.
+ */
+template<typename T>
+using BESpan = EndianSpan<T, Endianness::BigEndian>;
+
+/*!
+ * \brief A view over little endian values.
+ */
+template<typename T>
+using LESpan = EndianSpan<T, Endianness::LittleEndian>;
+
+/*!
+ * \brief Constructs an empty span.
+ */
+template<typename T, Endianness endianness>
+inline EndianSpan<T, endianness>::EndianSpan() :
+    m_data(nullptr),
+    m_size(0)
+{}
+
+/*!
+ * \brief Constructs a span over the \a size values stored at \a data.
+ * \remarks
+ *  - \a data does not need to be aligned.
+ *  - Does not take ownership over \a data which must hold at least \a size * sizeof(T) bytes as long as the
+ *    span is used.
+ */
+template<typename T, Endianness endianness>
+inline EndianSpan<T, endianness>::EndianSpan(const char *data, std::size_t size) :
+    m_data(data),
+    m_size(size)
+{}
+
+/*!
+ * \brief Returns the raw data.
+ */
+template<typename T, Endianness endianness>
+inline const char *EndianSpan<T, endianness>::data() const
+{
+    return m_data;
+}
+
+/*!
+ * \brief Returns the number of values.
+ */
+template<typename T, Endianness endianness>
+inline std::size_t EndianSpan<T, endianness>::size() const
+{
+    return m_size;
+}
+
+/*!
+ * \brief Returns the number of bytes the values occupy.
+ */
+template<typename T, Endianness endianness>
+inline std::size_t EndianSpan<T, endianness>::byteSize() const
+{
+    return m_size * sizeof(T);
+}
+
+/*!
+ * \brief Returns whether the span contains no values.
+ */
+template<typename T, Endianness endianness>
+inline bool EndianSpan<T, endianness>::empty() const
+{
+    return !m_size;
+}
+
+/*!
+ * \brief Returns the value with the specified \a index (decoded to the host byte order).
+ * \remarks The \a index is not checked.
+ */
+template<typename T, Endianness endianness>
+inline T EndianSpan<T, endianness>::operator[](std::size_t index) const
+{
+    return Field::decode(m_data + index * sizeof(T));
+}
+
+/*!
+ * \brief Returns the first value.
+ * \remarks The span must not be empty.
+ */
+template<typename T, Endianness endianness>
+inline T EndianSpan<T, endianness>::front() const
+{
+    return (*this)[0];
+}
+
+/*!
+ * \brief Returns the last value.
+ * \remarks The span must not be empty.
+ */
+template<typename T, Endianness endianness>
+inline T EndianSpan<T, endianness>::back() const
+{
+    return (*this)[m_size - 1];
+}
+
+/*!
+ * \brief Returns an iterator to the first value.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator EndianSpan<T, endianness>::begin() const
+{
+    return Iterator(m_data);
+}
+
+/*!
+ * \brief Returns an iterator behind the last value.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator EndianSpan<T, endianness>::end() const
+{
+    return Iterator(m_data + m_size * sizeof(T));
+}
+
+/*!
+ * \brief Returns a span over \a count values starting at the specified \a offset.
+ * \remarks The range is not checked.
+ */
+template<typename T, Endianness endianness>
+inline EndianSpan<T, endianness> EndianSpan<T, endianness>::subspan(std::size_t offset, std::size_t count) const
+{
+    return EndianSpan(m_data + offset * sizeof(T), count);
+}
+
+/*!
+ * \brief Copies all values to the specified \a values (decoded to the host byte order).
+ *
+ * The values are copied at once if the byte order matches the host byte order. Otherwise they are swapped
+ * block-wise using SIMD instructions if supported by the CPU (see swapOrder(const char *, uint32 *, std::size_t)).
+ *
+ * \remarks \a values must hold at least size() values.
+ */
+template<typename T, Endianness endianness>
+void EndianSpan<T, endianness>::copyTo(T *values) const
+{
+    static const bool isHostOrder = (endianness == Endianness::BigEndian) == CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN;
+    if(!m_size) {
+        return;
+    }
+    if(isHostOrder || sizeof(T) == 1) {
+        std::memcpy(values, m_data, byteSize());
+    } else {
+        swapOrder(m_data, reinterpret_cast<typename Detail::UIntOfWidth<sizeof(T)>::type *>(values), m_size);
+    }
+}
+
+/*!
+ * \brief Constructs an invalid iterator.
+ */
+template<typename T, Endianness endianness>
+inline EndianSpan<T, endianness>::Iterator::Iterator() :
+    m_pos(nullptr)
+{}
+
+/*!
+ * \brief Constructs an iterator pointing to the value at the specified \a position.
+ */
+template<typename T, Endianness endianness>
+inline EndianSpan<T, endianness>::Iterator::Iterator(const char *position) :
+    m_pos(position)
+{}
+
+/*!
+ * \brief Returns the raw position of the iterator.
+ */
+template<typename T, Endianness endianness>
+inline const char *EndianSpan<T, endianness>::Iterator::position() const
+{
+    return m_pos;
+}
+
+/*!
+ * \brief Returns the current value (decoded to the host byte order).
+ */
+template<typename T, Endianness endianness>
+inline T EndianSpan<T, endianness>::Iterator::operator*() const
+{
+    return Field::decode(m_pos);
+}
+
+/*!
+ * \brief Returns the value at the specified \a offset relative to the current value.
+ */
+template<typename T, Endianness endianness>
+inline T EndianSpan<T, endianness>::Iterator::operator[](difference_type offset) const
+{
+    return Field::decode(m_pos + offset * static_cast<difference_type>(sizeof(T)));
+}
+
+/*!
+ * \brief Advances to the next value.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator &EndianSpan<T, endianness>::Iterator::operator++()
+{
+    m_pos += sizeof(T);
+    return *this;
+}
+
+/*!
+ * \brief Advances to the next value returning the previous position.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator EndianSpan<T, endianness>::Iterator::operator++(int)
+{
+    const Iterator previous(*this);
+    m_pos += sizeof(T);
+    return previous;
+}
+
+/*!
+ * \brief Goes back to the previous value.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator &EndianSpan<T, endianness>::Iterator::operator--()
+{
+    m_pos -= sizeof(T);
+    return *this;
+}
+
+/*!
+ * \brief Goes back to the previous value returning the previous position.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator EndianSpan<T, endianness>::Iterator::operator--(int)
+{
+    const Iterator previous(*this);
+    m_pos -= sizeof(T);
+    return previous;
+}
+
+/*!
+ * \brief Advances by the specified number of values.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator &EndianSpan<T, endianness>::Iterator::operator+=(difference_type offset)
+{
+    m_pos += offset * static_cast<difference_type>(sizeof(T));
+    return *this;
+}
+
+/*!
+ * \brief Goes back by the specified number of values.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator &EndianSpan<T, endianness>::Iterator::operator-=(difference_type offset)
+{
+    m_pos -= offset * static_cast<difference_type>(sizeof(T));
+    return *this;
+}
+
+/*!
+ * \brief Returns an iterator advanced by the specified number of values.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator EndianSpan<T, endianness>::Iterator::operator+(difference_type offset) const
+{
+    return Iterator(m_pos + offset * static_cast<difference_type>(sizeof(T)));
+}
+
+/*!
+ * \brief Returns an iterator moved back by the specified number of values.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator EndianSpan<T, endianness>::Iterator::operator-(difference_type offset) const
+{
+    return Iterator(m_pos - offset * static_cast<difference_type>(sizeof(T)));
+}
+
+/*!
+ * \brief Returns the number of values between \a other and the current iterator.
+ */
+template<typename T, Endianness endianness>
+inline typename EndianSpan<T, endianness>::Iterator::difference_type EndianSpan<T, endianness>::Iterator::operator-(const Iterator &other) const
+{
+    return (m_pos - other.m_pos) / static_cast<difference_type>(sizeof(T));
+}
+
+/*!
+ * \brief Returns whether both iterators point to the same value.
+ */
+template<typename T, Endianness endianness>
+inline bool EndianSpan<T, endianness>::Iterator::operator==(const Iterator &other) const
+{
+    return m_pos == other.m_pos;
+}
+
+/*!
+ * \brief Returns whether the iterators point to different values.
+ */
+template<typename T, Endianness endianness>
+inline bool EndianSpan<T, endianness>::Iterator::operator!=(const Iterator &other) const
+{
+    return m_pos != other.m_pos;
+}
+
+/*!
+ * \brief Returns whether the current iterator points to a value before \a other.
+ */
+template<typename T, Endianness endianness>
+inline bool EndianSpan<T, endianness>::Iterator::operator<(const Iterator &other) const
+{
+    return m_pos < other.m_pos;
+}
+
+/*!
+ * \brief Returns whether the current iterator points to a value after \a other.
+ */
+template<typename T, Endianness endianness>
+inline bool EndianSpan<T, endianness>::Iterator::operator>(const Iterator &other) const
+{
+    return m_pos > other.m_pos;
+}
+
+/*!
+ * \brief Returns whether the current iterator points to a value before \a other or to the same value.
+ */
+template<typename T, Endianness endianness>
+inline bool EndianSpan<T, endianness>::Iterator::operator<=(const Iterator &other) const
+{
+    return m_pos <= other.m_pos;
+}
+
+/*!
+ * \brief Returns whether the current iterator points to a value after \a other or to the same value.
+ */
+template<typename T, Endianness endianness>
+inline bool EndianSpan<T, endianness>::Iterator::operator>=(const Iterator &other) const
+{
+    return m_pos >= other.m_pos;
+}
+
+}
+
+#endif // CONVERSION_UTILITIES_ENDIAN_SPAN_H
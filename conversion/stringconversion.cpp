@@ -1,10 +1,14 @@
 #include "./stringconversion.h"
+#include "./unicode.h"
 
 #include "../misc/memory.h"
 
 #include <sstream>
 #include <iomanip>
 #include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
 
 #include <iconv.h>
 #include <errno.h>
@@ -16,36 +20,19 @@ namespace ConversionUtilities
 
 /// \cond
 
-struct Keep { size_t operator()(size_t value) { return value; } };
-struct Double { size_t operator()(size_t value) { return value + value; } };
-struct Half { size_t operator()(size_t value) { return value / 2; } };
-struct Factor {
-    Factor(float factor) : factor(factor) {};
-    size_t operator()(size_t value) { return value * factor; }
-    float factor;
-};
-
-template<class OutputSizeHint>
 class ConversionDescriptor
 {
 public:
     ConversionDescriptor(const char *fromCharset, const char *toCharset) :
-        m_ptr(iconv_open(toCharset, fromCharset)),
-        m_outputSizeHint(OutputSizeHint())
+        m_ptr(iconv_open(toCharset, fromCharset))
     {
         if(m_ptr == reinterpret_cast<iconv_t>(-1)) {
             throw ConversionException("Unable to allocate descriptor for character set conversion.");
         }
     }
 
-    ConversionDescriptor(const char *fromCharset, const char *toCharset, OutputSizeHint outputSizeHint) :
-        m_ptr(iconv_open(toCharset, fromCharset)),
-        m_outputSizeHint(outputSizeHint)
-    {
-        if(m_ptr == reinterpret_cast<iconv_t>(-1)) {
-            throw ConversionException("Unable to allocate descriptor for character set conversion.");
-        }
-    }
+    ConversionDescriptor(const ConversionDescriptor &) = delete;
+    ConversionDescriptor &operator=(const ConversionDescriptor &) = delete;
 
     ~ConversionDescriptor()
     {
@@ -53,11 +40,13 @@ public:
     }
 
 public:
-    StringData convertString(const char *inputBuffer, size_t inputBufferSize)
+    StringData convertString(const char *inputBuffer, size_t inputBufferSize, size_t outputSize, float outputBufferSizeFactor)
     {
+        // reset the conversion state which might be left over from a previous (failed) conversion
+        iconv(m_ptr, nullptr, nullptr, nullptr, nullptr);
+
         // setup input and output buffer
         size_t inputBytesLeft = inputBufferSize;
-        size_t outputSize = m_outputSizeHint(inputBufferSize);
         size_t outputBytesLeft = outputSize;
         char *outputBuffer = reinterpret_cast<char *>(malloc(outputSize));
         size_t bytesWritten;
@@ -71,9 +60,10 @@ public:
                     bytesWritten = currentOutputOffset - outputBuffer;
                     break;
                 } else if(errno == E2BIG) {
-                    // output buffer has no more room for next converted character
+                    // output buffer has no more room for next converted character; grow at least by the current size
+                    // so the number of reallocations stays logarithmic if the size hint is too small
                     bytesWritten = currentOutputOffset - outputBuffer;
-                    outputBytesLeft = (outputSize += m_outputSizeHint(inputBytesLeft)) - bytesWritten;
+                    outputBytesLeft = (outputSize += max<size_t>(inputBytesLeft * outputBufferSizeFactor, max<size_t>(outputSize, 16))) - bytesWritten;
                     outputBuffer = reinterpret_cast<char *>(realloc(outputBuffer, outputSize));
                 } else /*if(errno == EILSEQ)*/ {
                     // invalid multibyte sequence in the input
@@ -90,9 +80,134 @@ public:
 
 private:
     iconv_t m_ptr;
-    OutputSizeHint m_outputSizeHint;
 };
 
+/*!
+ * \brief The ConversionDescriptorCache class keeps the most recently used conversion descriptors open.
+ *
+ * Opening a descriptor via iconv_open() is expensive compared to converting a short string. The descriptors are
+ * kept in most-recently-used order and the least recently used one is closed when the cache is full.
+ *
+ * \remarks The class is not thread-safe. convertString() uses one instance per thread.
+ */
+class ConversionDescriptorCache
+{
+public:
+    ConversionDescriptor &descriptor(const char *fromCharset, const char *toCharset);
+
+private:
+    struct Entry {
+        std::string fromCharset;
+        std::string toCharset;
+        std::unique_ptr<ConversionDescriptor> descriptor;
+    };
+    std::vector<Entry> m_entries;
+};
+
+/*!
+ * \brief The UnicodeCharset enum specifies the character sets the exact output size can be computed for.
+ */
+enum class UnicodeCharset
+{
+    Other,
+    Utf8,
+    Utf16LE,
+    Utf16BE,
+    Latin1
+};
+
+/*!
+ * \brief Returns the UnicodeCharset for the specified iconv character set name.
+ * \remarks Like iconv, the comparison is case-insensitive and ignores dashes and underscores.
+ */
+UnicodeCharset unicodeCharset(const char *charset)
+{
+    char normalized[9];
+    size_t size = 0;
+    for(; *charset; ++charset) {
+        if(*charset == '-' || *charset == '_') {
+            continue;
+        }
+        if(size == sizeof(normalized)) {
+            return UnicodeCharset::Other;
+        }
+        normalized[size++] = static_cast<char>(toupper(static_cast<unsigned char>(*charset)));
+    }
+    static const struct {
+        const char *name;
+        UnicodeCharset charset;
+    } knownCharsets[] = {
+        {"UTF8", UnicodeCharset::Utf8},
+        {"UTF16LE", UnicodeCharset::Utf16LE},
+        {"UTF16BE", UnicodeCharset::Utf16BE},
+        {"ISO88591", UnicodeCharset::Latin1},
+        {"LATIN1", UnicodeCharset::Latin1},
+    };
+    for(const auto &knownCharset : knownCharsets) {
+        if(strlen(knownCharset.name) == size && !memcmp(knownCharset.name, normalized, size)) {
+            return knownCharset.charset;
+        }
+    }
+    return UnicodeCharset::Other;
+}
+
+/*!
+ * \brief Computes the exact size of the output of the conversion of the specified input from \a fromCharset to
+ *        \a toCharset using the counting functions from unicode.h.
+ * \returns Returns whether the size could be computed. This is only the case for conversions between UTF-8,
+ *          UTF-16 and Latin-1.
+ */
+bool computeOutputSize(const char *fromCharset, const char *toCharset, const char *inputBuffer, size_t inputBufferSize, size_t &outputSize)
+{
+    const UnicodeCharset from = unicodeCharset(fromCharset), to = unicodeCharset(toCharset);
+    if(from == UnicodeCharset::Other || to == UnicodeCharset::Other) {
+        return false;
+    }
+    const char *const inputEnd = inputBuffer + inputBufferSize;
+    const bool toUtf16 = to == UnicodeCharset::Utf16LE || to == UnicodeCharset::Utf16BE;
+    switch(from) {
+    case UnicodeCharset::Utf8:
+        outputSize = toUtf16 ? utf16LengthOfUtf8(inputBuffer, inputEnd) * 2
+                             : (to == UnicodeCharset::Latin1 ? latin1LengthOfUtf8(inputBuffer, inputEnd) : inputBufferSize);
+        break;
+    case UnicodeCharset::Latin1:
+        outputSize = toUtf16 ? inputBufferSize * 2
+                             : (to == UnicodeCharset::Utf8 ? utf8LengthOfLatin1(inputBuffer, inputEnd) : inputBufferSize);
+        break;
+    default:
+        outputSize = toUtf16 ? inputBufferSize
+                             : (to == UnicodeCharset::Utf8
+                                ? utf8LengthOfUtf16(inputBuffer, inputEnd, from == UnicodeCharset::Utf16BE ? Endianness::BigEndian : Endianness::LittleEndian)
+                                : inputBufferSize / 2);
+    }
+    return true;
+}
+
+atomic<uint64> conversionDescriptorCacheHits(0);
+atomic<uint64> conversionDescriptorCacheMisses(0);
+
+/*!
+ * \brief Returns an open descriptor for the conversion from \a fromCharset to \a toCharset.
+ * \throws Throws ConversionException if no descriptor can be opened for the specified character sets.
+ */
+ConversionDescriptor &ConversionDescriptorCache::descriptor(const char *fromCharset, const char *toCharset)
+{
+    for(auto i = m_entries.begin(), end = m_entries.end(); i != end; ++i) {
+        if(i->fromCharset == fromCharset && i->toCharset == toCharset) {
+            conversionDescriptorCacheHits.fetch_add(1, memory_order_relaxed);
+            rotate(m_entries.begin(), i, i + 1);
+            return *m_entries.front().descriptor;
+        }
+    }
+    conversionDescriptorCacheMisses.fetch_add(1, memory_order_relaxed);
+    auto descriptor = make_unique<ConversionDescriptor>(fromCharset, toCharset);
+    if(m_entries.size() >= conversionDescriptorCacheCapacity) {
+        m_entries.pop_back();
+    }
+    m_entries.insert(m_entries.begin(), Entry{fromCharset, toCharset, move(descriptor)});
+    return *m_entries.front().descriptor;
+}
+
 /// \endcond
 
 /*!
@@ -103,64 +218,138 @@ private:
  * - The expected size of the output buffer can be specified via \a outputBufferSizeFactor. This hint helps
  *   to reduce buffer reallocations during the conversion (eg. for the conversion from Latin-1 to UTF-16
  *   the factor would be 2, for the conversion from UTF-16 to Latin-1 the factor would be 0.5).
+ * - For conversions between UTF-8, UTF-16LE, UTF-16BE and Latin-1 (ISO-8859-1) the exact size of the output is
+ *   computed before the conversion (see utf16LengthOfUtf8() and the other counting functions) so the output buffer
+ *   is allocated only once and \a outputBufferSizeFactor is ignored.
+ * - The iconv descriptors are kept open in a per-thread cache of conversionDescriptorCacheCapacity entries
+ *   so converting many strings between the same character sets does not open a new descriptor each time.
+ *   Use conversionDescriptorCacheStatistics() to check the effectiveness of the cache.
+ * - The whole input needs to be in memory. Use CharsetConverter to convert large inputs chunk by chunk.
+ * - This function and the convert*() functions for fixed pairs of character sets (eg. convertUtf8ToUtf16LE()) can
+ *   be called from multiple threads at the same time without further synchronization. No iconv descriptor or any
+ *   other mutable state is shared between threads.
  */
 StringData convertString(const char *fromCharset, const char *toCharset, const char *inputBuffer, std::size_t inputBufferSize, float outputBufferSizeFactor)
 {
-    return ConversionDescriptor<Factor>(fromCharset, toCharset, outputBufferSizeFactor).convertString(inputBuffer, inputBufferSize);
+    static thread_local ConversionDescriptorCache cache;
+    ConversionDescriptor &descriptor = cache.descriptor(fromCharset, toCharset);
+    size_t outputSize;
+    if(!computeOutputSize(fromCharset, toCharset, inputBuffer, inputBufferSize, outputSize)) {
+        outputSize = inputBufferSize * outputBufferSizeFactor;
+    }
+    return descriptor.convertString(inputBuffer, inputBufferSize, outputSize, outputBufferSizeFactor);
+}
+
+/*!
+ * \brief Returns how often convertString() could reuse a cached iconv descriptor (hits) and how often it had to
+ *        open a new one (misses).
+ * \remarks The counters are accumulated over all threads.
+ */
+ConversionDescriptorCacheStatistics conversionDescriptorCacheStatistics()
+{
+    return ConversionDescriptorCacheStatistics{conversionDescriptorCacheHits.load(memory_order_relaxed), conversionDescriptorCacheMisses.load(memory_order_relaxed)};
+}
+
+/*!
+ * \brief Resets the counters returned by conversionDescriptorCacheStatistics() to zero.
+ */
+void resetConversionDescriptorCacheStatistics()
+{
+    conversionDescriptorCacheHits.store(0, memory_order_relaxed);
+    conversionDescriptorCacheMisses.store(0, memory_order_relaxed);
+}
+
+/// \cond
+
+/*!
+ * \brief Converts the specified input using the specified built-in \a transcoder.
+ *
+ * The output buffer is allocated only once for the maximum size the \a transcoder might write. An incomplete
+ * sequence at the end of the input is ignored (like it is done by convertString()).
+ * \remarks Computing the exact size upfront (eg. via utf8LengthOfUtf16()) would save memory but takes about as long
+ *          as transcoding ASCII characters.
+ */
+template<typename Transcoder>
+StringData transcodeString(const char *inputBuffer, std::size_t inputBufferSize, std::size_t maxOutputSize, Transcoder transcoder)
+{
+    StringData result(std::unique_ptr<char[], StringDataDeleter>(reinterpret_cast<char *>(malloc(maxOutputSize))), 0);
+    if(!result.first && maxOutputSize) {
+        throw bad_alloc();
+    }
+    result.second = static_cast<size_t>(transcoder(inputBuffer, inputBuffer + inputBufferSize, result.first.get()) - result.first.get());
+    return result;
 }
 
+/// \endcond
+
 /*!
  * \brief Converts the specified UTF-8 string to UTF-16 (little-endian).
+ * \remarks Uses the built-in transcoder (see transcodeUtf8ToUtf16()) instead of iconv. Like all
+ *          conversion functions it is thread-safe (see convertString()).
  */
 StringData convertUtf8ToUtf16LE(const char *inputBuffer, std::size_t inputBufferSize)
 {
-    static ConversionDescriptor<Double> descriptor("UTF-8", "UTF-16LE");
-    return descriptor.convertString(inputBuffer, inputBufferSize);
+    return transcodeString(inputBuffer, inputBufferSize, maxUtf16SizeOfUtf8(inputBufferSize), [] (const char *&input, const char *inputEnd, char *output) {
+        return transcodeUtf8ToUtf16(input, inputEnd, output, Endianness::LittleEndian);
+    });
 }
 
 /*!
  * \brief Converts the specified UTF-16 (little-endian) string to UTF-8.
+ * \remarks Uses the built-in transcoder (see transcodeUtf16ToUtf8()) instead of iconv. Like all
+ *          conversion functions it is thread-safe (see convertString()).
  */
 StringData convertUtf16LEToUtf8(const char *inputBuffer, std::size_t inputBufferSize)
 {
-    static ConversionDescriptor<Half> descriptor("UTF-16LE", "UTF-8");
-    return descriptor.convertString(inputBuffer, inputBufferSize);
+    return transcodeString(inputBuffer, inputBufferSize, maxUtf8SizeOfUtf16(inputBufferSize), [] (const char *&input, const char *inputEnd, char *output) {
+        return transcodeUtf16ToUtf8(input, inputEnd, output, Endianness::LittleEndian);
+    });
 }
 
 /*!
  * \brief Converts the specified UTF-8 string to UTF-16 (big-endian).
+ * \remarks Uses the built-in transcoder (see transcodeUtf8ToUtf16()) instead of iconv. Like all
+ *          conversion functions it is thread-safe (see convertString()).
  */
 StringData convertUtf8ToUtf16BE(const char *inputBuffer, std::size_t inputBufferSize)
 {
-    static ConversionDescriptor<Double> descriptor("UTF-8", "UTF-16BE");
-    return descriptor.convertString(inputBuffer, inputBufferSize);
+    return transcodeString(inputBuffer, inputBufferSize, maxUtf16SizeOfUtf8(inputBufferSize), [] (const char *&input, const char *inputEnd, char *output) {
+        return transcodeUtf8ToUtf16(input, inputEnd, output, Endianness::BigEndian);
+    });
 }
 
 /*!
  * \brief Converts the specified UTF-16 (big-endian) string to UTF-8.
+ * \remarks Uses the built-in transcoder (see transcodeUtf16ToUtf8()) instead of iconv. Like all
+ *          conversion functions it is thread-safe (see convertString()).
  */
 StringData convertUtf16BEToUtf8(const char *inputBuffer, std::size_t inputBufferSize)
 {
-    static ConversionDescriptor<Half> descriptor("UTF-16BE", "UTF-8");
-    return descriptor.convertString(inputBuffer, inputBufferSize);
+    return transcodeString(inputBuffer, inputBufferSize, maxUtf8SizeOfUtf16(inputBufferSize), [] (const char *&input, const char *inputEnd, char *output) {
+        return transcodeUtf16ToUtf8(input, inputEnd, output, Endianness::BigEndian);
+    });
 }
 
 /*!
  * \brief Converts the specified Latin-1 string to UTF-8.
+ * \remarks Uses the built-in transcoder (see transcodeLatin1ToUtf8()) instead of iconv. Like all
+ *          conversion functions it is thread-safe (see convertString()).
  */
 StringData convertLatin1ToUtf8(const char *inputBuffer, std::size_t inputBufferSize)
 {
-    static ConversionDescriptor<Keep> descriptor("ISO-8859-1", "UTF-8");
-    return descriptor.convertString(inputBuffer, inputBufferSize);
+    return transcodeString(inputBuffer, inputBufferSize, maxUtf8SizeOfLatin1(inputBufferSize), &transcodeLatin1ToUtf8);
 }
 
 /*!
  * \brief Converts the specified UTF-8 string to Latin-1.
+ * \remarks Uses the built-in transcoder (see transcodeUtf8ToLatin1()) instead of iconv. Like all
+ *          conversion functions it is thread-safe (see convertString()).
+ * \throws Throws ConversionException if the input is not valid UTF-8 or contains characters which can not be
+ *         represented in Latin-1.
  */
 StringData convertUtf8ToLatin1(const char *inputBuffer, std::size_t inputBufferSize)
 {
-    static ConversionDescriptor<Factor> descriptor("UTF-8", "ISO-8859-1", 1.1);
-    return descriptor.convertString(inputBuffer, inputBufferSize);
+    return transcodeString(inputBuffer, inputBufferSize, maxLatin1SizeOfUtf8(inputBufferSize), &transcodeUtf8ToLatin1);
 }
 
 /*!
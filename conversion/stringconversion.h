@@ -38,7 +38,22 @@ struct CPP_UTILITIES_EXPORT StringDataDeleter {
 typedef std::pair<std::unique_ptr<char[], StringDataDeleter>, std::size_t> StringData;
 //typedef std::pair<std::unique_ptr<char>, std::size_t> StringData; // might work too
 
+/*!
+ * \brief The maximum number of iconv descriptors convertString() keeps open per thread.
+ */
+constexpr std::size_t conversionDescriptorCacheCapacity = 8;
+
+/*!
+ * \brief The ConversionDescriptorCacheStatistics struct holds the counters returned by conversionDescriptorCacheStatistics().
+ */
+struct ConversionDescriptorCacheStatistics {
+    uint64 hits; ///< The number of conversions which could reuse an open descriptor.
+    uint64 misses; ///< The number of conversions which needed to open a new descriptor.
+};
+
 CPP_UTILITIES_EXPORT StringData convertString(const char *fromCharset, const char *toCharset, const char *inputBuffer, std::size_t inputBufferSize, float outputBufferSizeFactor = 1.0f);
+CPP_UTILITIES_EXPORT ConversionDescriptorCacheStatistics conversionDescriptorCacheStatistics();
+CPP_UTILITIES_EXPORT void resetConversionDescriptorCacheStatistics();
 CPP_UTILITIES_EXPORT StringData convertUtf8ToUtf16LE(const char *inputBuffer, std::size_t inputBufferSize);
 CPP_UTILITIES_EXPORT StringData convertUtf16LEToUtf8(const char *inputBuffer, std::size_t inputBufferSize);
 CPP_UTILITIES_EXPORT StringData convertUtf8ToUtf16BE(const char *inputBuffer, std::size_t inputBufferSize);
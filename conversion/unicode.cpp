@@ -0,0 +1,856 @@
+#include "./unicode.h"
+#include "./conversionexception.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define CONVERSION_UTILITIES_X86_SIMD
+# include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace ConversionUtilities
+{
+
+/// \cond
+
+namespace {
+
+/*!
+ * \brief Processes the longest prefix of whole blocks of ASCII characters within \a input and \a end.
+ * \returns Returns the number of input bytes processed.
+ * \remarks The block size depends on the implementation; the rest is left for the scalar code.
+ */
+typedef size_t (*AsciiBlockFunction)(const char *input, const char *end, char *output, bool bigEndian);
+
+/*!
+ * \brief The AsciiBlockFunctions struct holds the fastest implementations of the ASCII fast paths supported by the CPU.
+ */
+struct AsciiBlockFunctions
+{
+    AsciiBlockFunction widen; // from 8-bit to 16-bit code units
+    AsciiBlockFunction narrow; // from 16-bit to 8-bit code units
+    AsciiBlockFunction copy; // from 8-bit to 8-bit code units
+};
+
+/*!
+ * \brief Specifies the number of bytes which are decoded one by one before trying the ASCII fast path again.
+ */
+constexpr ptrdiff_t scalarRunSize = 32;
+
+/*!
+ * \brief Specifies the bits which must not be set within 8 ASCII characters.
+ */
+constexpr uint64 nonAsciiBits = 0x8080808080808080ull;
+
+/*!
+ * \brief Widens ASCII characters from 8-bit to 16-bit code units checking 8 bytes at a time.
+ */
+size_t widenAsciiScalar(const char *input, const char *end, char *output, bool bigEndian)
+{
+    const char *i = input;
+    for(uint64 word; end - i >= 8; i += 8) {
+        memcpy(&word, i, 8);
+        if(word & nonAsciiBits) {
+            break;
+        }
+        for(const char *blockEnd = i + 8, *j = i; j != blockEnd; ++j, output += 2) {
+            output[bigEndian ? 0 : 1] = 0;
+            output[bigEndian ? 1 : 0] = *j;
+        }
+    }
+    return static_cast<size_t>(i - input);
+}
+
+/*!
+ * \brief Narrows ASCII characters from 16-bit to 8-bit code units checking 4 code units at a time.
+ */
+size_t narrowAsciiScalar(const char *input, const char *end, char *output, bool bigEndian)
+{
+    // the first byte in memory ends up in the least significant byte on little endian hosts and vice versa
+    const uint64 nonAsciiUnitBits = (bigEndian == CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN) ? 0x80FF80FF80FF80FFull : 0xFF80FF80FF80FF80ull;
+    const char *i = input;
+    for(uint64 word; end - i >= 8; i += 8) {
+        memcpy(&word, i, 8);
+        if(word & nonAsciiUnitBits) {
+            break;
+        }
+        for(const char *blockEnd = i + 8, *j = i + (bigEndian ? 1 : 0); j < blockEnd; j += 2) {
+            *output++ = *j;
+        }
+    }
+    return static_cast<size_t>(i - input);
+}
+
+/*!
+ * \brief Copies ASCII characters checking 8 bytes at a time.
+ */
+size_t copyAsciiScalar(const char *input, const char *end, char *output, bool)
+{
+    const char *i = input;
+    for(uint64 word; end - i >= 8; i += 8, output += 8) {
+        memcpy(&word, i, 8);
+        if(word & nonAsciiBits) {
+            break;
+        }
+        memcpy(output, &word, 8);
+    }
+    return static_cast<size_t>(i - input);
+}
+
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+
+/*!
+ * \brief Widens ASCII characters from 8-bit to 16-bit code units processing 16 bytes at a time using SSE2.
+ */
+__attribute__((target("sse2"))) size_t widenAsciiSse2(const char *input, const char *end, char *output, bool bigEndian)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const char *i = input;
+    for(; end - i >= 16; i += 16, output += 32) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(i));
+        if(_mm_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), bigEndian ? _mm_unpacklo_epi8(zero, bytes) : _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 16), bigEndian ? _mm_unpackhi_epi8(zero, bytes) : _mm_unpackhi_epi8(bytes, zero));
+    }
+    return static_cast<size_t>(i - input);
+}
+
+/*!
+ * \brief Narrows ASCII characters from 16-bit to 8-bit code units processing 16 code units at a time using SSE2.
+ */
+__attribute__((target("sse2"))) size_t narrowAsciiSse2(const char *input, const char *end, char *output, bool bigEndian)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonAsciiUnitBits = _mm_set1_epi16(static_cast<short>(bigEndian ? 0x80FF : 0xFF80));
+    const char *i = input;
+    for(; end - i >= 32; i += 32, output += 16) {
+        __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(i));
+        __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(i + 16));
+        const __m128i nonAsciiBytes = _mm_and_si128(_mm_or_si128(first, second), nonAsciiUnitBits);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(nonAsciiBytes, zero)) != 0xFFFF) {
+            break;
+        }
+        if(bigEndian) {
+            first = _mm_srli_epi16(first, 8);
+            second = _mm_srli_epi16(second, 8);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_packus_epi16(first, second));
+    }
+    return static_cast<size_t>(i - input);
+}
+
+/*!
+ * \brief Copies ASCII characters processing 16 bytes at a time using SSE2.
+ */
+__attribute__((target("sse2"))) size_t copyAsciiSse2(const char *input, const char *end, char *output, bool)
+{
+    const char *i = input;
+    for(; end - i >= 16; i += 16, output += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(i));
+        if(_mm_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), bytes);
+    }
+    return static_cast<size_t>(i - input);
+}
+
+/*!
+ * \brief Widens ASCII characters from 8-bit to 16-bit code units processing 32 bytes at a time using AVX2.
+ */
+__attribute__((target("avx2"))) size_t widenAsciiAvx2(const char *input, const char *end, char *output, bool bigEndian)
+{
+    const char *i = input;
+    for(; end - i >= 32; i += 32, output += 64) {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(i));
+        if(_mm256_movemask_epi8(bytes)) {
+            break;
+        }
+        __m256i first = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes));
+        __m256i second = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1));
+        if(bigEndian) {
+            first = _mm256_slli_epi16(first, 8);
+            second = _mm256_slli_epi16(second, 8);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output), first);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 32), second);
+    }
+    return static_cast<size_t>(i - input);
+}
+
+/*!
+ * \brief Narrows ASCII characters from 16-bit to 8-bit code units processing 32 code units at a time using AVX2.
+ */
+__attribute__((target("avx2"))) size_t narrowAsciiAvx2(const char *input, const char *end, char *output, bool bigEndian)
+{
+    const __m256i nonAsciiUnitBits = _mm256_set1_epi16(static_cast<short>(bigEndian ? 0x80FF : 0xFF80));
+    const char *i = input;
+    for(; end - i >= 64; i += 64, output += 32) {
+        __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(i));
+        __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(i + 32));
+        if(!_mm256_testz_si256(_mm256_or_si256(first, second), nonAsciiUnitBits)) {
+            break;
+        }
+        if(bigEndian) {
+            first = _mm256_srli_epi16(first, 8);
+            second = _mm256_srli_epi16(second, 8);
+        }
+        // packing works within 128-bit lanes so the 64-bit blocks need to be reordered afterwards
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output), _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8));
+    }
+    return static_cast<size_t>(i - input);
+}
+
+/*!
+ * \brief Copies ASCII characters processing 32 bytes at a time using AVX2.
+ */
+__attribute__((target("avx2"))) size_t copyAsciiAvx2(const char *input, const char *end, char *output, bool)
+{
+    const char *i = input;
+    for(; end - i >= 32; i += 32, output += 32) {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(i));
+        if(_mm256_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output), bytes);
+    }
+    return static_cast<size_t>(i - input);
+}
+
+#endif
+
+/*!
+ * \brief Returns the fastest implementations of the ASCII fast paths supported by the CPU.
+ */
+AsciiBlockFunctions selectAsciiBlockFunctions()
+{
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        return AsciiBlockFunctions{ &widenAsciiAvx2, &narrowAsciiAvx2, &copyAsciiAvx2 };
+    }
+    if(__builtin_cpu_supports("sse2")) {
+        return AsciiBlockFunctions{ &widenAsciiSse2, &narrowAsciiSse2, &copyAsciiSse2 };
+    }
+#endif
+    return AsciiBlockFunctions{ &widenAsciiScalar, &narrowAsciiScalar, &copyAsciiScalar };
+}
+
+/*!
+ * \brief Returns the ASCII fast paths to be used (determined once at runtime).
+ * \remarks The initialization of the function-local static is thread-safe so the transcoders can be used
+ *          concurrently right from the start.
+ */
+const AsciiBlockFunctions &asciiBlockFunctions()
+{
+    static const AsciiBlockFunctions functions = selectAsciiBlockFunctions();
+    return functions;
+}
+
+/*!
+ * \brief Counts code units within \a input and \a end.
+ * \remarks The meaning of \a flag depends on the function.
+ */
+typedef size_t (*CountFunction)(const char *input, const char *end, bool flag);
+
+/*!
+ * \brief The CountFunctions struct holds the fastest implementations of the counting functions supported by the CPU.
+ */
+struct CountFunctions
+{
+    CountFunction utf8Characters; // characters within UTF-8, counting supplementary characters twice if flag is set
+    CountFunction utf8SizeOfUtf16; // UTF-8 code units required to represent UTF-16, big-endian if flag is set
+    CountFunction nonAscii; // bytes which are not ASCII characters
+};
+
+/*!
+ * \brief Returns whether \a character is not a UTF-8 continuation byte.
+ */
+inline bool isUtf8LeadByte(char character)
+{
+    return static_cast<signed char>(character) >= -0x40;
+}
+
+/*!
+ * \brief Returns whether \a character starts a four byte UTF-8 sequence (or is no valid UTF-8 at all).
+ */
+inline bool isUtf8FourByteLead(char character)
+{
+    return static_cast<unsigned char>(character) >= 0xF0;
+}
+
+/*!
+ * \brief Returns the number of UTF-8 code units required to represent the specified UTF-16 code \a unit.
+ * \remarks Surrogates count 2 so a surrogate pair counts 4.
+ */
+inline size_t utf8SizeOfUtf16Unit(uint16 unit)
+{
+    return unit < 0x80 ? 1 : (unit < 0x800 || (unit & 0xF800) == 0xD800 ? 2 : 3);
+}
+
+/*!
+ * \brief Counts the characters within UTF-8 one byte at a time.
+ */
+size_t countUtf8CharactersScalar(const char *input, const char *end, bool countSupplementaryTwice)
+{
+    size_t count = 0;
+    for(; input != end; ++input) {
+        count += isUtf8LeadByte(*input) + (countSupplementaryTwice && isUtf8FourByteLead(*input));
+    }
+    return count;
+}
+
+/*!
+ * \brief Counts the UTF-8 code units required to represent UTF-16 one code unit at a time.
+ */
+size_t countUtf8SizeOfUtf16Scalar(const char *input, const char *end, bool bigEndian)
+{
+    size_t count = 0;
+    for(end -= (end - input) % 2; input != end; input += 2) {
+        count += utf8SizeOfUtf16Unit(bigEndian ? BE::toUInt16(input) : LE::toUInt16(input));
+    }
+    return count;
+}
+
+/*!
+ * \brief Counts the non-ASCII characters one byte at a time.
+ */
+size_t countNonAsciiScalar(const char *input, const char *end, bool)
+{
+    size_t count = 0;
+    for(; input != end; ++input) {
+        count += static_cast<unsigned char>(*input) >> 7;
+    }
+    return count;
+}
+
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+
+/*!
+ * \brief Counts the characters within UTF-8 processing 16 bytes at a time using SSE2.
+ */
+__attribute__((target("sse2"))) size_t countUtf8CharactersSse2(const char *input, const char *end, bool countSupplementaryTwice)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lastContinuationByte = _mm_set1_epi8(-0x41);
+    const __m128i lastThreeByteLead = _mm_set1_epi8(-0x11);
+    size_t count = 0;
+    for(; end - input >= 16; input += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+        count += static_cast<size_t>(__builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, lastContinuationByte))));
+        if(countSupplementaryTwice) {
+            const __m128i fourByteLeads = _mm_and_si128(_mm_cmpgt_epi8(bytes, lastThreeByteLead), _mm_cmplt_epi8(bytes, zero));
+            count += static_cast<size_t>(__builtin_popcount(_mm_movemask_epi8(fourByteLeads)));
+        }
+    }
+    return count + countUtf8CharactersScalar(input, end, countSupplementaryTwice);
+}
+
+/*!
+ * \brief Counts the UTF-8 code units required to represent UTF-16 processing 16 code units at a time using SSE2.
+ */
+__attribute__((target("sse2"))) size_t countUtf8SizeOfUtf16Sse2(const char *input, const char *end, bool bigEndian)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lastOneByteUnit = _mm_set1_epi16(0x7F);
+    const __m128i lastTwoByteUnit = _mm_set1_epi16(0x7FF);
+    const __m128i surrogateMask = _mm_set1_epi16(static_cast<short>(0xF800));
+    const __m128i surrogateBits = _mm_set1_epi16(static_cast<short>(0xD800));
+    size_t count = 0;
+    for(; end - input >= 32; input += 32) {
+        __m128i units[2] = { _mm_loadu_si128(reinterpret_cast<const __m128i *>(input)), _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 16)) };
+        __m128i oneByteUnits[2], twoByteUnits[2], surrogates[2];
+        for(size_t j = 0; j != 2; ++j) {
+            if(bigEndian) {
+                units[j] = _mm_or_si128(_mm_slli_epi16(units[j], 8), _mm_srli_epi16(units[j], 8));
+            }
+            // SSE2 lacks unsigned 16-bit comparisons; the saturating subtraction yields zero if the unit is not greater
+            oneByteUnits[j] = _mm_cmpeq_epi16(_mm_subs_epu16(units[j], lastOneByteUnit), zero);
+            twoByteUnits[j] = _mm_cmpeq_epi16(_mm_subs_epu16(units[j], lastTwoByteUnit), zero);
+            surrogates[j] = _mm_cmpeq_epi16(_mm_and_si128(units[j], surrogateMask), surrogateBits);
+        }
+        count += 48
+                - static_cast<size_t>(__builtin_popcount(_mm_movemask_epi8(_mm_packs_epi16(oneByteUnits[0], oneByteUnits[1]))))
+                - static_cast<size_t>(__builtin_popcount(_mm_movemask_epi8(_mm_packs_epi16(twoByteUnits[0], twoByteUnits[1]))))
+                - static_cast<size_t>(__builtin_popcount(_mm_movemask_epi8(_mm_packs_epi16(surrogates[0], surrogates[1]))));
+    }
+    return count + countUtf8SizeOfUtf16Scalar(input, end, bigEndian);
+}
+
+/*!
+ * \brief Counts the non-ASCII characters processing 16 bytes at a time using SSE2.
+ */
+__attribute__((target("sse2"))) size_t countNonAsciiSse2(const char *input, const char *end, bool)
+{
+    size_t count = 0;
+    for(; end - input >= 16; input += 16) {
+        count += static_cast<size_t>(__builtin_popcount(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input)))));
+    }
+    return count + countNonAsciiScalar(input, end, false);
+}
+
+/*!
+ * \brief Counts the characters within UTF-8 processing 32 bytes at a time using AVX2.
+ */
+__attribute__((target("avx2,popcnt"))) size_t countUtf8CharactersAvx2(const char *input, const char *end, bool countSupplementaryTwice)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lastContinuationByte = _mm256_set1_epi8(-0x41);
+    const __m256i lastThreeByteLead = _mm256_set1_epi8(-0x11);
+    size_t count = 0;
+    for(; end - input >= 32; input += 32) {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input));
+        count += static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(bytes, lastContinuationByte)))));
+        if(countSupplementaryTwice) {
+            const __m256i fourByteLeads = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, lastThreeByteLead), _mm256_cmpgt_epi8(zero, bytes));
+            count += static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm256_movemask_epi8(fourByteLeads))));
+        }
+    }
+    return count + countUtf8CharactersScalar(input, end, countSupplementaryTwice);
+}
+
+/*!
+ * \brief Counts the UTF-8 code units required to represent UTF-16 processing 32 code units at a time using AVX2.
+ */
+__attribute__((target("avx2,popcnt"))) size_t countUtf8SizeOfUtf16Avx2(const char *input, const char *end, bool bigEndian)
+{
+    const __m256i lastOneByteUnit = _mm256_set1_epi16(0x7F);
+    const __m256i lastTwoByteUnit = _mm256_set1_epi16(0x7FF);
+    const __m256i surrogateMask = _mm256_set1_epi16(static_cast<short>(0xF800));
+    const __m256i surrogateBits = _mm256_set1_epi16(static_cast<short>(0xD800));
+    size_t count = 0;
+    for(; end - input >= 64; input += 64) {
+        __m256i units[2] = { _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input)), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + 32)) };
+        __m256i oneByteUnits[2], twoByteUnits[2], surrogates[2];
+        for(size_t j = 0; j != 2; ++j) {
+            if(bigEndian) {
+                units[j] = _mm256_or_si256(_mm256_slli_epi16(units[j], 8), _mm256_srli_epi16(units[j], 8));
+            }
+            oneByteUnits[j] = _mm256_cmpeq_epi16(_mm256_max_epu16(units[j], lastOneByteUnit), lastOneByteUnit);
+            twoByteUnits[j] = _mm256_cmpeq_epi16(_mm256_max_epu16(units[j], lastTwoByteUnit), lastTwoByteUnit);
+            surrogates[j] = _mm256_cmpeq_epi16(_mm256_and_si256(units[j], surrogateMask), surrogateBits);
+        }
+        // packing mixes up the order of the code units which does not matter for counting
+        count += 96
+                - static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_packs_epi16(oneByteUnits[0], oneByteUnits[1])))))
+                - static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_packs_epi16(twoByteUnits[0], twoByteUnits[1])))))
+                - static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_packs_epi16(surrogates[0], surrogates[1])))));
+    }
+    return count + countUtf8SizeOfUtf16Scalar(input, end, bigEndian);
+}
+
+/*!
+ * \brief Counts the non-ASCII characters processing 32 bytes at a time using AVX2.
+ */
+__attribute__((target("avx2,popcnt"))) size_t countNonAsciiAvx2(const char *input, const char *end, bool)
+{
+    size_t count = 0;
+    for(; end - input >= 32; input += 32) {
+        count += static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(input))))));
+    }
+    return count + countNonAsciiScalar(input, end, false);
+}
+
+#endif
+
+/*!
+ * \brief Returns the fastest implementations of the counting functions supported by the CPU.
+ */
+CountFunctions selectCountFunctions()
+{
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return CountFunctions{ &countUtf8CharactersAvx2, &countUtf8SizeOfUtf16Avx2, &countNonAsciiAvx2 };
+    }
+    if(__builtin_cpu_supports("sse2")) {
+        return CountFunctions{ &countUtf8CharactersSse2, &countUtf8SizeOfUtf16Sse2, &countNonAsciiSse2 };
+    }
+#endif
+    return CountFunctions{ &countUtf8CharactersScalar, &countUtf8SizeOfUtf16Scalar, &countNonAsciiScalar };
+}
+
+/*!
+ * \brief Returns the counting functions to be used (determined once at runtime).
+ */
+const CountFunctions &countFunctions()
+{
+    static const CountFunctions functions = selectCountFunctions();
+    return functions;
+}
+
+/*!
+ * \brief Throws a ConversionException for an invalid sequence within the input.
+ */
+[[noreturn]] void throwInvalidSequence()
+{
+    throw ConversionException("Invalid multibyte sequence in the input.");
+}
+
+/*!
+ * \brief Decodes the UTF-8 sequence at \a input (which must not be \a end) into \a codePoint.
+ *
+ * Overlong sequences, encoded surrogates and code points beyond U+10FFFF are rejected.
+ *
+ * \returns Returns the length of the sequence or zero if the sequence is incomplete.
+ * \throws Throws ConversionException if the sequence is invalid.
+ */
+inline size_t decodeUtf8(const char *input, const char *end, uint32 &codePoint)
+{
+    const byte first = static_cast<byte>(*input);
+    if(first < 0x80) {
+        codePoint = first;
+        return 1;
+    }
+    size_t length;
+    byte minSecond = 0x80, maxSecond = 0xBF;
+    if(first < 0xC2) {
+        throwInvalidSequence();
+    } else if(first < 0xE0) {
+        length = 2;
+        codePoint = first & 0x1F;
+    } else if(first < 0xF0) {
+        length = 3;
+        codePoint = first & 0x0F;
+        if(first == 0xE0) {
+            minSecond = 0xA0;
+        } else if(first == 0xED) {
+            maxSecond = 0x9F;
+        }
+    } else if(first < 0xF5) {
+        length = 4;
+        codePoint = first & 0x07;
+        if(first == 0xF0) {
+            minSecond = 0x90;
+        } else if(first == 0xF4) {
+            maxSecond = 0x8F;
+        }
+    } else {
+        throwInvalidSequence();
+    }
+    const size_t available = min(static_cast<size_t>(end - input), length);
+    for(size_t i = 1; i != available; ++i, minSecond = 0x80, maxSecond = 0xBF) {
+        const byte continuation = static_cast<byte>(input[i]);
+        if(continuation < minSecond || continuation > maxSecond) {
+            throwInvalidSequence();
+        }
+        codePoint = (codePoint << 6) | (continuation & 0x3F);
+    }
+    return available == length ? length : 0;
+}
+
+/*!
+ * \brief Returns the UTF-16 code unit stored at \a input.
+ */
+template<Endianness endianness>
+inline uint16 loadUnit(const char *input)
+{
+    return endianness == Endianness::BigEndian ? BE::toUInt16(input) : LE::toUInt16(input);
+}
+
+/*!
+ * \brief Stores the UTF-16 code unit \a unit at \a output.
+ */
+template<Endianness endianness>
+inline void storeUnit(uint16 unit, char *output)
+{
+    if(endianness == Endianness::BigEndian) {
+        BE::getBytes(unit, output);
+    } else {
+        LE::getBytes(unit, output);
+    }
+}
+
+/*!
+ * \brief Decodes the UTF-16 sequence at \a input (which must provide at least one code unit) into \a codePoint.
+ * \returns Returns the length of the sequence in bytes or zero if the sequence is incomplete.
+ * \throws Throws ConversionException if the sequence is an unpaired surrogate.
+ */
+template<Endianness endianness>
+inline size_t decodeUtf16(const char *input, const char *end, uint32 &codePoint)
+{
+    const uint16 first = loadUnit<endianness>(input);
+    if(first < 0xD800 || first > 0xDFFF) {
+        codePoint = first;
+        return 2;
+    }
+    if(first > 0xDBFF) {
+        throwInvalidSequence();
+    }
+    if(end - input < 4) {
+        return 0;
+    }
+    const uint16 second = loadUnit<endianness>(input + 2);
+    if(second < 0xDC00 || second > 0xDFFF) {
+        throwInvalidSequence();
+    }
+    codePoint = 0x10000 + ((static_cast<uint32>(first) - 0xD800) << 10) + (second - 0xDC00);
+    return 4;
+}
+
+/*!
+ * \brief Encodes the specified \a codePoint as UTF-8 at \a output.
+ * \returns Returns the end of the encoded sequence.
+ */
+inline char *encodeUtf8(uint32 codePoint, char *output)
+{
+    if(codePoint < 0x80) {
+        *output++ = static_cast<char>(codePoint);
+    } else if(codePoint < 0x800) {
+        *output++ = static_cast<char>(0xC0 | (codePoint >> 6));
+        *output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if(codePoint < 0x10000) {
+        *output++ = static_cast<char>(0xE0 | (codePoint >> 12));
+        *output++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        *output++ = static_cast<char>(0xF0 | (codePoint >> 18));
+        *output++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        *output++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    return output;
+}
+
+/*!
+ * \brief Encodes the specified \a codePoint as UTF-16 at \a output.
+ * \returns Returns the end of the encoded sequence.
+ */
+template<Endianness endianness>
+inline char *encodeUtf16(uint32 codePoint, char *output)
+{
+    if(codePoint < 0x10000) {
+        storeUnit<endianness>(static_cast<uint16>(codePoint), output);
+        return output + 2;
+    }
+    codePoint -= 0x10000;
+    storeUnit<endianness>(static_cast<uint16>(0xD800 | (codePoint >> 10)), output);
+    storeUnit<endianness>(static_cast<uint16>(0xDC00 | (codePoint & 0x3FF)), output + 2);
+    return output + 4;
+}
+
+template<Endianness endianness>
+char *utf8ToUtf16(const char *&input, const char *end, char *output)
+{
+    const AsciiBlockFunction widenAscii = asciiBlockFunctions().widen;
+    const char *i = input;
+    while(i != end) {
+        const size_t asciiSize = widenAscii(i, end, output, endianness == Endianness::BigEndian);
+        i += asciiSize;
+        output += asciiSize * 2;
+        for(const char *const runEnd = i + min(end - i, scalarRunSize); i < runEnd;) {
+            uint32 codePoint;
+            const size_t length = decodeUtf8(i, end, codePoint);
+            if(!length) {
+                input = i;
+                return output;
+            }
+            i += length;
+            output = encodeUtf16<endianness>(codePoint, output);
+        }
+    }
+    input = i;
+    return output;
+}
+
+template<Endianness endianness>
+char *utf16ToUtf8(const char *&input, const char *end, char *output)
+{
+    const AsciiBlockFunction narrowAscii = asciiBlockFunctions().narrow;
+    const char *i = input;
+    while(end - i >= 2) {
+        const size_t asciiSize = narrowAscii(i, end, output, endianness == Endianness::BigEndian);
+        i += asciiSize;
+        output += asciiSize / 2;
+        for(const char *const runEnd = i + min(end - i, scalarRunSize); runEnd - i >= 2;) {
+            uint32 codePoint;
+            const size_t length = decodeUtf16<endianness>(i, end, codePoint);
+            if(!length) {
+                input = i;
+                return output;
+            }
+            i += length;
+            output = encodeUtf8(codePoint, output);
+        }
+    }
+    input = i;
+    return output;
+}
+
+}
+
+/// \endcond
+
+/*!
+ * \brief Transcodes the UTF-8 string within \a input and \a inputEnd to UTF-16 storing the result at \a output.
+ *
+ * Runs of ASCII characters are widened 16 or 32 bytes at a time using SIMD instructions (if supported by the CPU,
+ * determined at runtime). Other characters are decoded one by one.
+ *
+ * \param input Specifies the start of the input. It is advanced to the end of the last complete sequence which has
+ *              been transcoded. So it only differs from \a inputEnd if the input ends with an incomplete sequence
+ *              which allows continuing the conversion once more input is available.
+ * \param output Specifies the output buffer which must provide maxUtf16SizeOfUtf8() bytes.
+ * \param endianness Specifies the byte order of the output.
+ * \returns Returns the end of the output.
+ * \throws Throws ConversionException if the input contains an invalid sequence (eg. an overlong sequence or an
+ *         encoded surrogate). \a input is not advanced in that case.
+ */
+char *transcodeUtf8ToUtf16(const char *&input, const char *inputEnd, char *output, Endianness endianness)
+{
+    return endianness == Endianness::BigEndian
+            ? utf8ToUtf16<Endianness::BigEndian>(input, inputEnd, output)
+            : utf8ToUtf16<Endianness::LittleEndian>(input, inputEnd, output);
+}
+
+/*!
+ * \brief Transcodes the UTF-16 string within \a input and \a inputEnd to UTF-8 storing the result at \a output.
+ *
+ * Runs of ASCII characters are narrowed 16 or 32 code units at a time using SIMD instructions (if supported by the CPU,
+ * determined at runtime). Other characters are decoded one by one.
+ *
+ * \param input Specifies the start of the input. It is advanced to the end of the last complete sequence which has
+ *              been transcoded. So it only differs from \a inputEnd if the input ends with an incomplete sequence
+ *              (a single byte or a high surrogate) which allows continuing the conversion once more input is available.
+ * \param output Specifies the output buffer which must provide maxUtf8SizeOfUtf16() bytes.
+ * \param endianness Specifies the byte order of the input.
+ * \returns Returns the end of the output.
+ * \throws Throws ConversionException if the input contains an unpaired surrogate. \a input is not advanced in that case.
+ */
+char *transcodeUtf16ToUtf8(const char *&input, const char *inputEnd, char *output, Endianness endianness)
+{
+    return endianness == Endianness::BigEndian
+            ? utf16ToUtf8<Endianness::BigEndian>(input, inputEnd, output)
+            : utf16ToUtf8<Endianness::LittleEndian>(input, inputEnd, output);
+}
+
+/*!
+ * \brief Transcodes the Latin-1 string within \a input and \a inputEnd to UTF-8 storing the result at \a output.
+ *
+ * Runs of ASCII characters are copied 16 or 32 bytes at a time using SIMD instructions (if supported by the CPU,
+ * determined at runtime).
+ *
+ * \param input Specifies the start of the input. It is advanced to \a inputEnd.
+ * \param output Specifies the output buffer which must provide maxUtf8SizeOfLatin1() bytes.
+ * \returns Returns the end of the output.
+ */
+char *transcodeLatin1ToUtf8(const char *&input, const char *inputEnd, char *output)
+{
+    const AsciiBlockFunction copyAscii = asciiBlockFunctions().copy;
+    const char *i = input;
+    while(i != inputEnd) {
+        const size_t asciiSize = copyAscii(i, inputEnd, output, false);
+        i += asciiSize;
+        output += asciiSize;
+        for(const char *const runEnd = i + min(inputEnd - i, scalarRunSize); i != runEnd; ++i) {
+            const byte character = static_cast<byte>(*i);
+            if(character < 0x80) {
+                *output++ = static_cast<char>(character);
+            } else {
+                *output++ = static_cast<char>(0xC0 | (character >> 6));
+                *output++ = static_cast<char>(0x80 | (character & 0x3F));
+            }
+        }
+    }
+    input = i;
+    return output;
+}
+
+/*!
+ * \brief Transcodes the UTF-8 string within \a input and \a inputEnd to Latin-1 storing the result at \a output.
+ *
+ * Runs of ASCII characters are copied 16 or 32 bytes at a time using SIMD instructions (if supported by the CPU,
+ * determined at runtime). Other characters are decoded one by one.
+ *
+ * \param input Specifies the start of the input. It is advanced to the end of the last complete sequence which has
+ *              been transcoded (see transcodeUtf8ToUtf16()).
+ * \param output Specifies the output buffer which must provide maxLatin1SizeOfUtf8() bytes.
+ * \returns Returns the end of the output.
+ * \throws Throws ConversionException if the input contains an invalid sequence or a character which can not be
+ *         represented in Latin-1. \a input is not advanced in that case.
+ */
+char *transcodeUtf8ToLatin1(const char *&input, const char *inputEnd, char *output)
+{
+    const AsciiBlockFunction copyAscii = asciiBlockFunctions().copy;
+    const char *i = input;
+    while(i != inputEnd) {
+        const size_t asciiSize = copyAscii(i, inputEnd, output, false);
+        i += asciiSize;
+        output += asciiSize;
+        for(const char *const runEnd = i + min(inputEnd - i, scalarRunSize); i < runEnd;) {
+            uint32 codePoint;
+            const size_t length = decodeUtf8(i, inputEnd, codePoint);
+            if(!length) {
+                input = i;
+                return output;
+            }
+            if(codePoint > 0xFF) {
+                throw ConversionException("The input contains a character which can not be represented in Latin-1.");
+            }
+            i += length;
+            *output++ = static_cast<char>(codePoint);
+        }
+    }
+    input = i;
+    return output;
+}
+
+/*!
+ * \brief Returns the number of UTF-16 code units required to represent the UTF-8 string within \a input and \a inputEnd.
+ *
+ * The computation is done 16 or 32 bytes at a time using SIMD instructions (if supported by the CPU, determined at runtime).
+ *
+ * \remarks
+ * - The result is exact for valid input. Otherwise it is at least the number of code units transcodeUtf8ToUtf16() writes.
+ *   So it can be used to allocate the output buffer for transcodeUtf8ToUtf16() exactly.
+ * - The size in bytes is twice the returned value.
+ */
+size_t utf16LengthOfUtf8(const char *input, const char *inputEnd)
+{
+    return countFunctions().utf8Characters(input, inputEnd, true);
+}
+
+/*!
+ * \brief Returns the number of UTF-8 code units (bytes) required to represent the UTF-16 string within \a input and \a inputEnd.
+ *
+ * The computation is done 16 or 32 code units at a time using SIMD instructions (if supported by the CPU, determined at
+ * runtime).
+ *
+ * \param endianness Specifies the byte order of the input.
+ * \remarks The result is exact for valid input. Otherwise it is at least the number of code units transcodeUtf16ToUtf8()
+ *          writes. So it can be used to allocate the output buffer for transcodeUtf16ToUtf8() exactly.
+ */
+size_t utf8LengthOfUtf16(const char *input, const char *inputEnd, Endianness endianness)
+{
+    return countFunctions().utf8SizeOfUtf16(input, inputEnd, endianness == Endianness::BigEndian);
+}
+
+/*!
+ * \brief Returns the number of UTF-8 code units (bytes) required to represent the Latin-1 string within \a input and \a inputEnd.
+ *
+ * The computation is done 16 or 32 bytes at a time using SIMD instructions (if supported by the CPU, determined at runtime).
+ */
+size_t utf8LengthOfLatin1(const char *input, const char *inputEnd)
+{
+    return static_cast<size_t>(inputEnd - input) + countFunctions().nonAscii(input, inputEnd, false);
+}
+
+/*!
+ * \brief Returns the number of Latin-1 characters (bytes) required to represent the UTF-8 string within \a input and \a inputEnd.
+ *
+ * The computation is done 16 or 32 bytes at a time using SIMD instructions (if supported by the CPU, determined at runtime).
+ *
+ * \remarks The result is exact for valid input which only contains characters which can be represented in Latin-1.
+ *          Otherwise it is at least the number of bytes transcodeUtf8ToLatin1() writes.
+ */
+size_t latin1LengthOfUtf8(const char *input, const char *inputEnd)
+{
+    return countFunctions().utf8Characters(input, inputEnd, false);
+}
+
+}
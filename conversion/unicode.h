@@ -0,0 +1,53 @@
+#ifndef CONVERSION_UTILITIES_UNICODE_H
+#define CONVERSION_UTILITIES_UNICODE_H
+
+#include "./binaryconversion.h"
+
+#include <cstddef>
+
+namespace ConversionUtilities {
+
+CPP_UTILITIES_EXPORT char *transcodeUtf8ToUtf16(const char *&input, const char *inputEnd, char *output, Endianness endianness);
+CPP_UTILITIES_EXPORT char *transcodeUtf16ToUtf8(const char *&input, const char *inputEnd, char *output, Endianness endianness);
+CPP_UTILITIES_EXPORT char *transcodeLatin1ToUtf8(const char *&input, const char *inputEnd, char *output);
+CPP_UTILITIES_EXPORT char *transcodeUtf8ToLatin1(const char *&input, const char *inputEnd, char *output);
+CPP_UTILITIES_EXPORT std::size_t utf16LengthOfUtf8(const char *input, const char *inputEnd);
+CPP_UTILITIES_EXPORT std::size_t utf8LengthOfUtf16(const char *input, const char *inputEnd, Endianness endianness);
+CPP_UTILITIES_EXPORT std::size_t utf8LengthOfLatin1(const char *input, const char *inputEnd);
+CPP_UTILITIES_EXPORT std::size_t latin1LengthOfUtf8(const char *input, const char *inputEnd);
+
+/*!
+ * \brief Returns the number of bytes transcodeUtf8ToUtf16() might write at most for \a inputSize bytes of input.
+ */
+constexpr std::size_t maxUtf16SizeOfUtf8(std::size_t inputSize)
+{
+    return inputSize * 2;
+}
+
+/*!
+ * \brief Returns the number of bytes transcodeUtf16ToUtf8() might write at most for \a inputSize bytes of input.
+ */
+constexpr std::size_t maxUtf8SizeOfUtf16(std::size_t inputSize)
+{
+    return inputSize / 2 * 3;
+}
+
+/*!
+ * \brief Returns the number of bytes transcodeLatin1ToUtf8() might write at most for \a inputSize bytes of input.
+ */
+constexpr std::size_t maxUtf8SizeOfLatin1(std::size_t inputSize)
+{
+    return inputSize * 2;
+}
+
+/*!
+ * \brief Returns the number of bytes transcodeUtf8ToLatin1() might write at most for \a inputSize bytes of input.
+ */
+constexpr std::size_t maxLatin1SizeOfUtf8(std::size_t inputSize)
+{
+    return inputSize;
+}
+
+}
+
+#endif // CONVERSION_UTILITIES_UNICODE_H
@@ -0,0 +1,491 @@
+#include "./varint.h"
+#include "./binaryconversion.h"
+#include "./conversionexception.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define CONVERSION_UTILITIES_X86_SIMD
+# include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace ConversionUtilities
+{
+
+/// \cond
+
+namespace {
+
+/*!
+ * \brief Returns the number of trailing zero bits of the specified \a value (which must not be zero).
+ */
+inline unsigned int trailingZeroBits(uint64 value)
+{
+#ifdef __GNUC__
+    return static_cast<unsigned int>(__builtin_ctzll(value));
+#else
+    unsigned int count = 0;
+    for(; !(value & 1); value >>= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/*!
+ * \brief Concatenates the lower 7 bits of each byte of the specified little endian \a word.
+ *
+ * This is what pext with the mask 0x7F7F7F7F7F7F7F7F does but it only takes a few shifts and masks.
+ */
+inline uint64 concatenateSevenBitGroups(uint64 word)
+{
+    word &= 0x7F7F7F7F7F7F7F7Full;
+    word = (word & 0x007F007F007F007Full) | ((word & 0x7F007F007F007F00ull) >> 1);
+    word = (word & 0x00003FFF00003FFFull) | ((word & 0x3FFF00003FFF0000ull) >> 2);
+    word = (word & 0x000000000FFFFFFFull) | ((word & 0x0FFFFFFF00000000ull) >> 4);
+    return word;
+}
+
+/*!
+ * \brief Decodes the LEB128 encoded value at \a buffer (which must provide at least 8 bytes) without
+ *        looping over the bytes.
+ *
+ * The terminating byte is located by looking at the continuation bits of 8 bytes at once. The 7-bit groups
+ * before it are concatenated via concatenateSevenBitGroups().
+ *
+ * \returns Returns the length of the value or zero if the value is longer than 8 bytes.
+ */
+inline size_t decodeLeb128Bits(const char *buffer, uint64 &bits)
+{
+    const uint64 word = LE::toUInt64(buffer);
+    const uint64 terminationBits = ~word & 0x8080808080808080ull;
+    if(!terminationBits) {
+        return 0;
+    }
+    bits = concatenateSevenBitGroups(word & (terminationBits ^ (terminationBits - 1)));
+    return (trailingZeroBits(terminationBits) >> 3) + 1;
+}
+
+/*!
+ * \brief Decodes the unsigned LEB128 encoded value at \a buffer byte by byte.
+ * \returns Returns the length of the value or zero if \a end is reached before the end of the value.
+ */
+size_t decodeULeb128Bytewise(const char *buffer, const char *end, uint64 &value)
+{
+    uint64 result = 0;
+    const char *i = buffer;
+    for(unsigned int shift = 0; i != end; shift += 7) {
+        const byte currentByte = static_cast<byte>(*i++);
+        if(shift == 63 && currentByte > 1) {
+            throw ConversionException("LEB128 encoded integer exceeds 64 bit.");
+        }
+        result |= static_cast<uint64>(currentByte & 0x7F) << shift;
+        if(!(currentByte & 0x80)) {
+            value = result;
+            return static_cast<size_t>(i - buffer);
+        }
+    }
+    return 0;
+}
+
+/*!
+ * \brief Decodes the signed LEB128 encoded value at \a buffer byte by byte.
+ * \returns Returns the length of the value or zero if \a end is reached before the end of the value.
+ */
+size_t decodeSLeb128Bytewise(const char *buffer, const char *end, int64 &value)
+{
+    uint64 result = 0;
+    const char *i = buffer;
+    for(unsigned int shift = 0; i != end; shift += 7) {
+        const byte currentByte = static_cast<byte>(*i++);
+        if(shift == 63 && (currentByte & 0x80)) {
+            throw ConversionException("LEB128 encoded integer exceeds 64 bit.");
+        }
+        result |= static_cast<uint64>(currentByte & 0x7F) << shift;
+        if(!(currentByte & 0x80)) {
+            if(shift < 57 && (currentByte & 0x40)) {
+                result |= ~static_cast<uint64>(0) << (shift + 7);
+            }
+            value = static_cast<int64>(result);
+            return static_cast<size_t>(i - buffer);
+        }
+    }
+    return 0;
+}
+
+/*!
+ * \brief The ULeb128Codec struct provides the decoding functions for unsigned LEB128 used by the batch decoders.
+ */
+struct ULeb128Codec
+{
+    typedef uint64 ValueType;
+
+    static size_t decode(const char *buffer, const char *end, uint64 &value)
+    {
+        if(end - buffer >= 8) {
+            if(const size_t length = decodeLeb128Bits(buffer, value)) {
+                return length;
+            }
+        }
+        return decodeULeb128Bytewise(buffer, end, value);
+    }
+
+    static uint64 decodeSingleByte(char value)
+    {
+        return static_cast<byte>(value);
+    }
+
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+    __attribute__((target("sse2"))) static unsigned int singleByteMask(__m128i bytes)
+    {
+        return ~static_cast<unsigned int>(_mm_movemask_epi8(bytes)) & 0xFFFF;
+    }
+
+    __attribute__((target("sse2"))) static __m128i decodeSingleBytes(__m128i bytes)
+    {
+        return bytes;
+    }
+#endif
+};
+
+/*!
+ * \brief The SLeb128Codec struct provides the decoding functions for signed LEB128 used by the batch decoders.
+ */
+struct SLeb128Codec
+{
+    typedef int64 ValueType;
+
+    static size_t decode(const char *buffer, const char *end, int64 &value)
+    {
+        if(end - buffer >= 8) {
+            uint64 bits;
+            if(const size_t length = decodeLeb128Bits(buffer, bits)) {
+                const unsigned int unusedBits = 64 - 7 * static_cast<unsigned int>(length);
+                value = static_cast<int64>(bits << unusedBits) >> unusedBits;
+                return length;
+            }
+        }
+        return decodeSLeb128Bytewise(buffer, end, value);
+    }
+
+    static int64 decodeSingleByte(char value)
+    {
+        return static_cast<int64>((static_cast<byte>(value) ^ 0x40) - 0x40);
+    }
+
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+    __attribute__((target("sse2"))) static unsigned int singleByteMask(__m128i bytes)
+    {
+        return ~static_cast<unsigned int>(_mm_movemask_epi8(bytes)) & 0xFFFF;
+    }
+
+    __attribute__((target("sse2"))) static __m128i decodeSingleBytes(__m128i bytes)
+    {
+        // sign-extend the 7-bit values to 8 bit
+        const __m128i signBit = _mm_set1_epi8(0x40);
+        return _mm_sub_epi8(_mm_xor_si128(bytes, signBit), signBit);
+    }
+#endif
+};
+
+/*!
+ * \brief The VIntCodec struct provides the decoding functions for EBML VINTs used by the batch decoders.
+ */
+struct VIntCodec
+{
+    typedef uint64 ValueType;
+
+    static size_t decode(const char *buffer, const char *end, uint64 &value)
+    {
+        if(buffer == end) {
+            return 0;
+        }
+        const size_t length = vIntLength(*buffer);
+        if(!length) {
+            throw ConversionException("VINT exceeds maximum of 8 bytes.");
+        }
+        uint64 bits;
+        if(end - buffer >= 8) {
+            bits = BE::toUInt64(buffer) >> (64 - 8 * length);
+        } else if(static_cast<size_t>(end - buffer) >= length) {
+            bits = 0;
+            for(const char *i = buffer, *valueEnd = buffer + length; i != valueEnd; ++i) {
+                bits = (bits << 8) | static_cast<byte>(*i);
+            }
+        } else {
+            return 0;
+        }
+        const uint64 dataMask = (static_cast<uint64>(1) << (7 * length)) - 1;
+        bits &= dataMask;
+        value = bits == dataMask ? vIntUnknownSize : bits;
+        return length;
+    }
+
+    static uint64 decodeSingleByte(char value)
+    {
+        return static_cast<byte>(value) == 0xFF ? vIntUnknownSize : (static_cast<byte>(value) & 0x7F);
+    }
+
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+    __attribute__((target("sse2"))) static unsigned int singleByteMask(__m128i bytes)
+    {
+        // the marker bit must be the most significant bit and the unknown-size marker 0xFF is treated separately
+        const __m128i unknownSizeMarkers = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(0xFF)));
+        return static_cast<unsigned int>(_mm_movemask_epi8(bytes) & ~_mm_movemask_epi8(unknownSizeMarkers)) & 0xFFFF;
+    }
+
+    __attribute__((target("sse2"))) static __m128i decodeSingleBytes(__m128i bytes)
+    {
+        return _mm_and_si128(bytes, _mm_set1_epi8(0x7F));
+    }
+#endif
+};
+
+/*!
+ * \brief Decodes \a count values using \a Codec one after another.
+ * \returns Returns the number of bytes consumed or zero if \a end is reached before all values have been decoded.
+ */
+template<typename Codec>
+size_t decodeBatchScalar(const char *buffer, const char *end, typename Codec::ValueType *values, size_t count)
+{
+    const char *i = buffer;
+    for(; count; --count, ++values) {
+        const size_t length = Codec::decode(i, end, *values);
+        if(!length) {
+            return 0;
+        }
+        i += length;
+    }
+    return static_cast<size_t>(i - buffer);
+}
+
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+
+/*!
+ * \brief Widens the 16 bytes of \a bytes to 64-bit and stores them at \a values.
+ * \param isSigned Specifies whether the bytes are sign-extended (instead of zero-extended).
+ */
+__attribute__((target("sse2"))) inline void storeWidened(__m128i bytes, char *values, bool isSigned)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i words[2] = {
+        _mm_unpacklo_epi8(bytes, isSigned ? _mm_cmpgt_epi8(zero, bytes) : zero),
+        _mm_unpackhi_epi8(bytes, isSigned ? _mm_cmpgt_epi8(zero, bytes) : zero)
+    };
+    for(const __m128i &word : words) {
+        const __m128i wordSigns = isSigned ? _mm_srai_epi16(word, 15) : zero;
+        const __m128i doubleWords[2] = { _mm_unpacklo_epi16(word, wordSigns), _mm_unpackhi_epi16(word, wordSigns) };
+        for(const __m128i &doubleWord : doubleWords) {
+            const __m128i doubleWordSigns = isSigned ? _mm_srai_epi32(doubleWord, 31) : zero;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(values), _mm_unpacklo_epi32(doubleWord, doubleWordSigns));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(values + 16), _mm_unpackhi_epi32(doubleWord, doubleWordSigns));
+            values += 32;
+        }
+    }
+}
+
+/*!
+ * \brief Decodes \a count values using \a Codec processing 16 bytes at a time.
+ *
+ * Blocks of 16 single-byte values (the common case for small integers) are widened via SSE2 without looking
+ * at the bytes individually. Otherwise the single-byte values before the first longer value are stored
+ * directly and the longer value is decoded via Codec::decode().
+ *
+ * \returns Returns the number of bytes consumed or zero if \a end is reached before all values have been decoded.
+ */
+template<typename Codec>
+__attribute__((target("sse2"))) size_t decodeBatchSse2(const char *buffer, const char *end, typename Codec::ValueType *values, size_t count)
+{
+    const char *i = buffer;
+    while(count >= 16 && end - i >= 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(i));
+        const unsigned int singleByteMask = Codec::singleByteMask(bytes);
+        if(singleByteMask == 0xFFFF) {
+            storeWidened(Codec::decodeSingleBytes(bytes), reinterpret_cast<char *>(values),
+                         std::is_signed<typename Codec::ValueType>::value);
+            i += 16, values += 16, count -= 16;
+            continue;
+        }
+        for(const char *singleByteEnd = i + trailingZeroBits(~singleByteMask); i != singleByteEnd; ++i, ++values, --count) {
+            *values = Codec::decodeSingleByte(*i);
+        }
+        const size_t length = Codec::decode(i, end, *values);
+        if(!length) {
+            return 0;
+        }
+        i += length, ++values, --count;
+    }
+    if(count) {
+        const size_t remainingLength = decodeBatchScalar<Codec>(i, end, values, count);
+        if(!remainingLength) {
+            return 0;
+        }
+        i += remainingLength;
+    }
+    return static_cast<size_t>(i - buffer);
+}
+
+#endif
+
+/*!
+ * \brief Decodes \a count values (see decodeBatchScalar() and decodeBatchSse2()).
+ */
+template<typename Codec>
+using BatchDecoder = size_t (*)(const char *buffer, const char *end, typename Codec::ValueType *values, size_t count);
+
+/*!
+ * \brief Returns the fastest batch decoder for \a Codec supported by the CPU.
+ */
+template<typename Codec>
+BatchDecoder<Codec> selectBatchDecoder()
+{
+#ifdef CONVERSION_UTILITIES_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("sse2")) {
+        return &decodeBatchSse2<Codec>;
+    }
+#endif
+    return &decodeBatchScalar<Codec>;
+}
+
+/*!
+ * \brief Decodes \a count values using the fastest batch decoder available for the CPU (determined once at runtime).
+ */
+template<typename Codec>
+inline size_t decodeBatch(const char *buffer, const char *end, typename Codec::ValueType *values, size_t count)
+{
+    static const BatchDecoder<Codec> decode = selectBatchDecoder<Codec>();
+    return decode(buffer, end, values, count);
+}
+
+}
+
+/// \endcond
+
+/*!
+ * \brief Applies zigZagDecode() to \a count \a values storing the results at \a results.
+ * \remarks \a values and \a results might point to the same memory.
+ */
+void zigZagDecode(const uint64 *values, int64 *results, size_t count)
+{
+    for(const uint64 *end = values + count; values != end; ++values, ++results) {
+        *results = zigZagDecode(*values);
+    }
+}
+
+/*!
+ * \brief Decodes the unsigned LEB128 encoded value at \a buffer storing it in \a value.
+ *
+ * If at least 8 bytes are available, values of up to 8 bytes are decoded without looping over the bytes.
+ *
+ * \returns Returns the number of bytes the value occupies or zero if \a end is reached before the end of
+ *          the value (\a value is not modified in that case).
+ * \throws Throws ConversionException if the value exceeds 64 bit.
+ */
+size_t decodeULeb128(const char *buffer, const char *end, uint64 &value)
+{
+    return ULeb128Codec::decode(buffer, end, value);
+}
+
+/*!
+ * \brief Decodes the signed LEB128 encoded value at \a buffer storing it in \a value.
+ *
+ * If at least 8 bytes are available, values of up to 8 bytes are decoded without looping over the bytes.
+ *
+ * \returns Returns the number of bytes the value occupies or zero if \a end is reached before the end of
+ *          the value (\a value is not modified in that case).
+ * \throws Throws ConversionException if the value exceeds 64 bit.
+ */
+size_t decodeSLeb128(const char *buffer, const char *end, int64 &value)
+{
+    return SLeb128Codec::decode(buffer, end, value);
+}
+
+/*!
+ * \brief Decodes \a count consecutive unsigned LEB128 encoded values at \a buffer storing them in \a values.
+ *
+ * Runs of single-byte values are decoded 16 at a time using SIMD instructions (if supported by the CPU).
+ *
+ * \returns Returns the number of bytes consumed or zero if \a end is reached before all values have been
+ *          decoded (the values decoded so far are stored in that case).
+ * \throws Throws ConversionException if a value exceeds 64 bit.
+ */
+size_t decodeULeb128(const char *buffer, const char *end, uint64 *values, size_t count)
+{
+    return decodeBatch<ULeb128Codec>(buffer, end, values, count);
+}
+
+/*!
+ * \brief Decodes \a count consecutive signed LEB128 encoded values at \a buffer storing them in \a values.
+ *
+ * Runs of single-byte values are decoded 16 at a time using SIMD instructions (if supported by the CPU).
+ *
+ * \returns Returns the number of bytes consumed or zero if \a end is reached before all values have been
+ *          decoded (the values decoded so far are stored in that case).
+ * \throws Throws ConversionException if a value exceeds 64 bit.
+ */
+size_t decodeSLeb128(const char *buffer, const char *end, int64 *values, size_t count)
+{
+    return decodeBatch<SLeb128Codec>(buffer, end, values, count);
+}
+
+/*!
+ * \brief Encodes the specified \a value as EBML variable size integer (VINT) storing it at \a buffer.
+ *
+ * The length is encoded by the position of the first set bit (the marker) within the first byte. The remaining
+ * bits hold the value in big endian byte order.
+ *
+ * \param value Specifies the value. Values of up to 2^56 - 2 are supported. Passing vIntUnknownSize produces
+ *              the marker for elements of unknown size.
+ * \param length Specifies the number of bytes to use (up to maxVIntSize). Zero means the minimum length
+ *               (see vIntSize()) is used. A bigger length is useful to reserve space for a size which is only
+ *               known after writing the element.
+ * \returns Returns the number of bytes written.
+ * \throws Throws ConversionException if \a value is too big or does not fit into the specified \a length.
+ */
+size_t encodeVInt(uint64 value, char *buffer, size_t length)
+{
+    const size_t minLength = vIntSize(value);
+    if(!minLength) {
+        throw ConversionException("The value exceeds the maximum of VINTs.");
+    }
+    if(!length) {
+        length = minLength;
+    } else if(length < minLength || length > maxVIntSize) {
+        throw ConversionException("The value can not be encoded as VINT of the specified length.");
+    }
+    const uint64 marker = static_cast<uint64>(1) << (7 * length);
+    uint64 bits = (value == vIntUnknownSize ? marker - 1 : value) | marker;
+    for(char *i = buffer + length; i != buffer; bits >>= 8) {
+        *--i = static_cast<char>(bits);
+    }
+    return length;
+}
+
+/*!
+ * \brief Decodes the EBML variable size integer (VINT) at \a buffer storing it in \a value.
+ * \remarks VINTs with all data bits set are decoded to vIntUnknownSize.
+ * \returns Returns the number of bytes the value occupies or zero if \a end is reached before the end of
+ *          the value (\a value is not modified in that case).
+ * \throws Throws ConversionException if the first byte is zero (which would denote a length of more than 8 bytes).
+ */
+size_t decodeVInt(const char *buffer, const char *end, uint64 &value)
+{
+    return VIntCodec::decode(buffer, end, value);
+}
+
+/*!
+ * \brief Decodes \a count consecutive EBML variable size integers (VINTs) at \a buffer storing them in \a values.
+ *
+ * Runs of single-byte values are decoded 16 at a time using SIMD instructions (if supported by the CPU).
+ *
+ * \returns Returns the number of bytes consumed or zero if \a end is reached before all values have been
+ *          decoded (the values decoded so far are stored in that case).
+ * \throws Throws ConversionException if the first byte of a value is zero.
+ */
+size_t decodeVInt(const char *buffer, const char *end, uint64 *values, size_t count)
+{
+    return decodeBatch<VIntCodec>(buffer, end, values, count);
+}
+
+}
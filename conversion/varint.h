@@ -0,0 +1,147 @@
+#ifndef CONVERSION_UTILITIES_VARINT_H
+#define CONVERSION_UTILITIES_VARINT_H
+
+#include "./types.h"
+#include "../global.h"
+
+#include <cstddef>
+
+namespace ConversionUtilities {
+
+/*!
+ * \brief The maximum number of bytes an LEB128 encoded 64-bit integer occupies.
+ */
+constexpr std::size_t maxLeb128Size = 10;
+
+/*!
+ * \brief The maximum number of bytes an EBML variable size integer (VINT) occupies.
+ */
+constexpr std::size_t maxVIntSize = 8;
+
+/*!
+ * \brief The value VINTs with all data bits set are decoded to.
+ * \remarks Such VINTs are used by EBML/Matroska to denote elements of unknown size. Passing this value to
+ *          encodeVInt() produces such a marker.
+ */
+constexpr uint64 vIntUnknownSize = static_cast<uint64>(-1);
+
+/*!
+ * \brief Maps the specified signed \a value to an unsigned integer so that values of small magnitude
+ *        remain small (0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...).
+ * \remarks This is used by Protocol Buffers to store signed integers as varints efficiently.
+ */
+constexpr uint32 zigZagEncode(int32 value)
+{
+    return (static_cast<uint32>(value) << 1) ^ static_cast<uint32>(value >> 31);
+}
+
+/*!
+ * \brief Maps the specified signed \a value to an unsigned integer so that values of small magnitude
+ *        remain small (0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...).
+ */
+constexpr uint64 zigZagEncode(int64 value)
+{
+    return (static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63);
+}
+
+/*!
+ * \brief Reverts zigZagEncode().
+ */
+constexpr int32 zigZagDecode(uint32 value)
+{
+    return static_cast<int32>((value >> 1) ^ (0u - (value & 1u)));
+}
+
+/*!
+ * \brief Reverts zigZagEncode().
+ */
+constexpr int64 zigZagDecode(uint64 value)
+{
+    return static_cast<int64>((value >> 1) ^ (0ull - (value & 1ull)));
+}
+
+CPP_UTILITIES_EXPORT void zigZagDecode(const uint64 *values, int64 *results, std::size_t count);
+
+/*!
+ * \brief Returns the number of bytes the specified \a value occupies when encoded via encodeULeb128().
+ */
+inline std::size_t uLeb128Size(uint64 value)
+{
+    std::size_t size = 1;
+    for(; value >= 0x80; value >>= 7) {
+        ++size;
+    }
+    return size;
+}
+
+/*!
+ * \brief Encodes the specified \a value as unsigned LEB128 storing it at \a buffer.
+ * \returns Returns the number of bytes written (at most maxLeb128Size).
+ */
+inline std::size_t encodeULeb128(uint64 value, char *buffer)
+{
+    char *i = buffer;
+    for(; value >= 0x80; value >>= 7) {
+        *i++ = static_cast<char>(value | 0x80);
+    }
+    *i++ = static_cast<char>(value);
+    return static_cast<std::size_t>(i - buffer);
+}
+
+/*!
+ * \brief Encodes the specified \a value as signed LEB128 storing it at \a buffer.
+ * \returns Returns the number of bytes written (at most maxLeb128Size).
+ */
+inline std::size_t encodeSLeb128(int64 value, char *buffer)
+{
+    char *i = buffer;
+    // continue until the remaining bits are all equal to the sign bit of the last byte
+    for(; value < -0x40 || value >= 0x40; value >>= 7) {
+        *i++ = static_cast<char>(value | 0x80);
+    }
+    *i++ = static_cast<char>(value & 0x7F);
+    return static_cast<std::size_t>(i - buffer);
+}
+
+CPP_UTILITIES_EXPORT std::size_t decodeULeb128(const char *buffer, const char *end, uint64 &value);
+CPP_UTILITIES_EXPORT std::size_t decodeSLeb128(const char *buffer, const char *end, int64 &value);
+CPP_UTILITIES_EXPORT std::size_t decodeULeb128(const char *buffer, const char *end, uint64 *values, std::size_t count);
+CPP_UTILITIES_EXPORT std::size_t decodeSLeb128(const char *buffer, const char *end, int64 *values, std::size_t count);
+
+/*!
+ * \brief Returns the length of the VINT starting with the specified \a firstByte or zero if \a firstByte
+ *        is zero (which is not a valid start of a VINT).
+ */
+inline std::size_t vIntLength(char firstByte)
+{
+    std::size_t length = 1;
+    for(byte mask = 0x80; mask && !(static_cast<byte>(firstByte) & mask); mask >>= 1) {
+        ++length;
+    }
+    return length <= maxVIntSize ? length : 0;
+}
+
+/*!
+ * \brief Returns the minimum number of bytes required to encode the specified \a value as VINT.
+ * \remarks Returns 1 for vIntUnknownSize and 0 if \a value is too big to be encoded (2^56 - 1 or more).
+ */
+inline std::size_t vIntSize(uint64 value)
+{
+    if(value == vIntUnknownSize) {
+        return 1;
+    }
+    // values with all data bits set are reserved for the unknown-size marker so they need one more byte
+    std::size_t size = 1;
+    for(++value; value >= 0x80; value >>= 7) {
+        ++size;
+    }
+    return size <= maxVIntSize ? size : 0;
+}
+
+CPP_UTILITIES_EXPORT std::size_t encodeVInt(uint64 value, char *buffer, std::size_t length = 0);
+CPP_UTILITIES_EXPORT std::size_t decodeVInt(const char *buffer, const char *end, uint64 &value);
+CPP_UTILITIES_EXPORT std::size_t decodeVInt(const char *buffer, const char *end, uint64 *values, std::size_t count);
+
+}
+
+#endif // CONVERSION_UTILITIES_VARINT_H
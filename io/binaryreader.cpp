@@ -1,14 +1,25 @@
 #include "./binaryreader.h"
+#include "./checksum.h"
 
 #include "../misc/memory.h"
+#include "../misc/arena.h"
 #include "../conversion/conversionexception.h"
+#include "../conversion/varint.h"
 
+#include <algorithm>
 #include <sstream>
 #include <cstring>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define IOUTILITIES_X86_SIMD
+# include <immintrin.h>
+#endif
 
 using namespace std;
 using namespace IoUtilities;
 using namespace ConversionUtilities;
+using namespace MemoryUtilities;
 
 /*!
  * \namespace IoUtilities
@@ -27,16 +38,18 @@ using namespace ConversionUtilities;
  */
 BinaryReader::BinaryReader(istream *stream) :
     m_stream(stream),
-    m_ownership(false)
+    m_ownership(false),
+    m_checksum(nullptr)
 {}
 
 /*!
  * \brief Copies the specified BinaryReader.
- * \remarks The copy will not take ownership over the stream.
+ * \remarks The copy will not take ownership over the stream and does not update the checksum.
  */
 BinaryReader::BinaryReader(const BinaryReader &other) :
     m_stream(other.m_stream),
-    m_ownership(false)
+    m_ownership(false),
+    m_checksum(nullptr)
 {}
 
 /*!
@@ -98,22 +111,30 @@ istream::pos_type BinaryReader::readStreamsize()
  */
 string BinaryReader::readLengthPrefixedString()
 {
-    static const int maxPrefixLength = 4;
-    int prefixLength = 1;
-    byte beg = m_stream->peek();
-    byte mask = 0x80;
-    while(prefixLength <= maxPrefixLength && (beg & mask) == 0) {
-        ++prefixLength;
-        mask >>= 1;
-    }
-    if(prefixLength > maxPrefixLength) {
-        throw ConversionException("Length denotation of length-prefixed string exceeds maximum.");
-    }
-    memset(m_buffer, 0, maxPrefixLength);
-    m_stream->read(m_buffer + (maxPrefixLength - prefixLength), prefixLength);
-    *(m_buffer + (maxPrefixLength - prefixLength)) ^= mask;
-    uint32 prefix = BE::toUInt32(m_buffer);
-    return readString(prefix);
+    return readString(readLengthPrefix());
+}
+
+/*!
+ * \brief Reads a length prefixed string from the current stream into \a result.
+ *
+ * \remarks The capacity of \a result is reused so reading many strings into the same object does not allocate
+ *          once the capacity suffices. Advances the current position of the stream like readLengthPrefixedString().
+ */
+void BinaryReader::readLengthPrefixedString(string &result)
+{
+    readString(result, readLengthPrefix());
+}
+
+/*!
+ * \brief Skips a length prefixed string.
+ *
+ * Advances the current position of the stream like readLengthPrefixedString() without storing the string.
+ *
+ * \remarks The string is still passed to the assigned checksum (if any).
+ */
+void BinaryReader::skipLengthPrefixedString()
+{
+    skipBytes(readLengthPrefix());
 }
 
 /*!
@@ -122,25 +143,35 @@ string BinaryReader::readLengthPrefixedString()
 string BinaryReader::readString(size_t length)
 {
     string res;
-    res.resize(length);
-    m_stream->read(&res[0], length);
+    readString(res, length);
     return res;
 }
 
+/*!
+ * \brief Reads a string of the given \a length into \a result and advances the current position of the stream by \a length byte.
+ * \remarks The capacity of \a result is reused so reading many strings into the same object does not allocate
+ *          once the capacity suffices.
+ */
+void BinaryReader::readString(string &result, size_t length)
+{
+    result.resize(length);
+    read(&result[0], static_cast<streamsize>(length));
+}
+
 /*!
  * \brief Reads a terminated string from the current stream.
  *
  * Advances the current position of the stream by the string length plus one byte.
  *
  * \param termination The byte to be recognized as termination value.
+ * \remarks Sets the fail bit and the end-of-stream bit of the stream if the end of the stream is reached before
+ *          the termination value. The string contains the data read so far in that case.
  */
 string BinaryReader::readTerminatedString(byte termination)
 {
-    stringstream ss(ios_base::in | ios_base::out | ios_base::binary);
-    ss.exceptions(ios_base::badbit | ios_base::failbit);
-    m_stream->get(*ss.rdbuf(), termination); // delim byte is not extracted from the stream
-    m_stream->seekg(1, ios_base::cur); // "extract" delim byte manually
-    return ss.str();
+    string res;
+    readTerminatedString(res, termination);
+    return res;
 }
 
 /*!
@@ -154,14 +185,33 @@ string BinaryReader::readTerminatedString(byte termination)
  */
 string BinaryReader::readTerminatedString(size_t maxBytesToRead, byte termination)
 {
-    unique_ptr<char []> buff  = make_unique<char []>(maxBytesToRead);
-    for(char *i = buff.get(), *end = i + maxBytesToRead; i < end; ++i) {
-        m_stream->get(*i);
-        if(*(reinterpret_cast<byte *>(i)) == termination) {
-            return string(buff.get(), i - buff.get());
-        }
-    }
-    return string(buff.get(), maxBytesToRead);
+    string res;
+    readTerminatedString(res, maxBytesToRead, termination);
+    return res;
+}
+
+/*!
+ * \brief Reads a terminated string from the current stream into \a result.
+ *
+ * Behaves like readTerminatedString(byte) but reuses the capacity of \a result so reading many strings
+ * into the same object does not allocate once the capacity suffices.
+ */
+void BinaryReader::readTerminatedString(string &result, byte termination)
+{
+    result.clear();
+    appendTerminatedString(result, numeric_limits<size_t>::max(), termination);
+}
+
+/*!
+ * \brief Reads a terminated string from the current stream into \a result.
+ *
+ * Behaves like readTerminatedString(size_t, byte) but reuses the capacity of \a result so reading many strings
+ * into the same object does not allocate once the capacity suffices.
+ */
+void BinaryReader::readTerminatedString(string &result, size_t maxBytesToRead, byte termination)
+{
+    result.clear();
+    appendTerminatedString(result, maxBytesToRead, termination);
 }
 
 /*!
@@ -170,18 +220,30 @@ string BinaryReader::readTerminatedString(size_t maxBytesToRead, byte terminatio
  * Advances the current position of the stream by the string length plus two bytes.
  *
  * \param termination Specifies the two byte sized big endian value to be recognized as termination.
+ * \remarks
+ *  - Only considers the termination at even offsets (relative to the current position).
+ *  - Sets the fail bit and the end-of-stream bit of the stream if the end of the stream is reached before
+ *    the termination value. The string contains the data read so far in that case.
  */
 string BinaryReader::readMultibyteTerminatedStringBE(uint16 termination)
 {
-    stringstream ss(ios_base::in | ios_base::out | ios_base::binary);
-    ss.exceptions(ios_base::badbit | ios_base::failbit);
-    char *delimChars = m_buffer, *buff = m_buffer + 2;
-    ConversionUtilities::BE::getBytes(termination, delimChars);
-    do {
-        m_stream->get(buff[0]);
-        m_stream->get(buff[1]);
-    } while(!((buff[0] == delimChars[0]) && (buff[1] == delimChars[1])));
-    return ss.str();
+    string res;
+    readMultibyteTerminatedStringBE(res, termination);
+    return res;
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string from the current stream into \a result.
+ *
+ * Behaves like readMultibyteTerminatedStringBE(uint16) but reuses the capacity of \a result so reading many strings
+ * into the same object does not allocate once the capacity suffices.
+ */
+void BinaryReader::readMultibyteTerminatedStringBE(string &result, uint16 termination)
+{
+    char delimChars[2];
+    BE::getBytes(termination, delimChars);
+    result.clear();
+    appendMultibyteTerminatedString(result, numeric_limits<size_t>::max(), delimChars);
 }
 
 /*!
@@ -190,18 +252,30 @@ string BinaryReader::readMultibyteTerminatedStringBE(uint16 termination)
  * Advances the current position of the stream by the string length plus two bytes.
  *
  * \param termination Specifies the two byte sized little endian value to be recognized as termination.
+ * \remarks
+ *  - Only considers the termination at even offsets (relative to the current position).
+ *  - Sets the fail bit and the end-of-stream bit of the stream if the end of the stream is reached before
+ *    the termination value. The string contains the data read so far in that case.
  */
 string BinaryReader::readMultibyteTerminatedStringLE(uint16 termination)
 {
-    stringstream ss(ios_base::in | ios_base::out | ios_base::binary);
-    ss.exceptions(ios_base::badbit | ios_base::failbit);
-    char *delimChars = m_buffer, *buff = m_buffer + 2;
-    ConversionUtilities::LE::getBytes(termination, delimChars);
-    do {
-        m_stream->get(buff[0]);
-        m_stream->get(buff[1]);
-    } while(!((buff[0] == delimChars[0]) && (buff[1] == delimChars[1])));
-    return ss.str();
+    string res;
+    readMultibyteTerminatedStringLE(res, termination);
+    return res;
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string from the current stream into \a result.
+ *
+ * Behaves like readMultibyteTerminatedStringLE(uint16) but reuses the capacity of \a result so reading many strings
+ * into the same object does not allocate once the capacity suffices.
+ */
+void BinaryReader::readMultibyteTerminatedStringLE(string &result, uint16 termination)
+{
+    char delimChars[2];
+    LE::getBytes(termination, delimChars);
+    result.clear();
+    appendMultibyteTerminatedString(result, numeric_limits<size_t>::max(), delimChars);
 }
 
 /*!
@@ -212,20 +286,27 @@ string BinaryReader::readMultibyteTerminatedStringLE(uint16 termination)
  *
  * \param maxBytesToRead The maximal number of bytes to read.
  * \param termination The two byte sized big endian value to be recognized as termination.
+ * \remarks Only considers the termination at even offsets (relative to the current position).
  */
 string BinaryReader::readMultibyteTerminatedStringBE(std::size_t maxBytesToRead, uint16 termination)
 {
-    unique_ptr<char []> buff = make_unique<char []>(maxBytesToRead);
-    char *delimChars = m_buffer;
-    ConversionUtilities::BE::getBytes(termination, delimChars);
-    for(char *i = buff.get(), *end = i + maxBytesToRead; (i + 1) < end; i += 2) {
-        m_stream->get(*i);
-        m_stream->get(*(i + 1));
-        if((*i == delimChars[0]) && (*(i + 1) == delimChars[1])) {
-            return string(buff.get(), i - buff.get());
-        }
-    }
-    return string(buff.get(), maxBytesToRead);
+    string res;
+    readMultibyteTerminatedStringBE(res, maxBytesToRead, termination);
+    return res;
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string from the current stream into \a result.
+ *
+ * Behaves like readMultibyteTerminatedStringBE(std::size_t, uint16) but reuses the capacity of \a result so reading many strings
+ * into the same object does not allocate once the capacity suffices.
+ */
+void BinaryReader::readMultibyteTerminatedStringBE(string &result, std::size_t maxBytesToRead, uint16 termination)
+{
+    char delimChars[2];
+    BE::getBytes(termination, delimChars);
+    result.clear();
+    appendMultibyteTerminatedString(result, maxBytesToRead, delimChars);
 }
 
 /*!
@@ -236,22 +317,566 @@ string BinaryReader::readMultibyteTerminatedStringBE(std::size_t maxBytesToRead,
  *
  * \param maxBytesToRead The maximal number of bytes to read.
  * \param termination The two byte sized little endian value to be recognized as termination.
+ * \remarks Only considers the termination at even offsets (relative to the current position).
  */
 string BinaryReader::readMultibyteTerminatedStringLE(std::size_t maxBytesToRead, uint16 termination)
 {
-    unique_ptr<char []> buff = make_unique<char []>(maxBytesToRead);
-    char *delimChars = m_buffer;
-    ConversionUtilities::LE::getBytes(termination, delimChars);
-    for(char *i = buff.get(), *end = i + maxBytesToRead; (i + 1) < end; i += 2) {
-        m_stream->get(*i);
-        m_stream->get(*(i + 1));
-        if((*i == delimChars[0]) && (*(i + 1) == delimChars[1])) {
-            return string(buff.get(), i - buff.get());
+    string res;
+    readMultibyteTerminatedStringLE(res, maxBytesToRead, termination);
+    return res;
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string from the current stream into \a result.
+ *
+ * Behaves like readMultibyteTerminatedStringLE(std::size_t, uint16) but reuses the capacity of \a result so reading many strings
+ * into the same object does not allocate once the capacity suffices.
+ */
+void BinaryReader::readMultibyteTerminatedStringLE(string &result, std::size_t maxBytesToRead, uint16 termination)
+{
+    char delimChars[2];
+    LE::getBytes(termination, delimChars);
+    result.clear();
+    appendMultibyteTerminatedString(result, maxBytesToRead, delimChars);
+}
+
+/*!
+ * \brief Reads the specified number of bytes from the stream in the specified \a buffer.
+ * \remarks The data is stored within the arena of \a buffer.
+ */
+void BinaryReader::read(ArenaVector<char> &buffer, streamsize length)
+{
+    buffer.resize(length);
+    read(buffer.data(), length);
+}
+
+/*!
+ * \brief Reads a length prefixed string from the current stream into \a result.
+ *
+ * Behaves like readLengthPrefixedString(std::string &) but stores the string within the arena of \a result.
+ */
+void BinaryReader::readLengthPrefixedString(ArenaString &result)
+{
+    readString(result, readLengthPrefix());
+}
+
+/*!
+ * \brief Reads a string of the given \a length into \a result and advances the current position of the stream by \a length byte.
+ * \remarks The string is stored within the arena of \a result.
+ */
+void BinaryReader::readString(ArenaString &result, size_t length)
+{
+    result.resize(length);
+    read(&result[0], static_cast<streamsize>(length));
+}
+
+/*!
+ * \brief Reads a terminated string from the current stream into \a result.
+ *
+ * Behaves like readTerminatedString(std::string &, byte) but stores the string within the arena of \a result.
+ */
+void BinaryReader::readTerminatedString(ArenaString &result, byte termination)
+{
+    result.clear();
+    appendTerminatedString(result, numeric_limits<size_t>::max(), termination);
+}
+
+/*!
+ * \brief Reads a terminated string from the current stream into \a result.
+ *
+ * Behaves like readTerminatedString(std::string &, std::size_t, byte) but stores the string within the arena of \a result.
+ */
+void BinaryReader::readTerminatedString(ArenaString &result, size_t maxBytesToRead, byte termination)
+{
+    result.clear();
+    appendTerminatedString(result, maxBytesToRead, termination);
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string from the current stream into \a result.
+ *
+ * Behaves like readMultibyteTerminatedStringBE(std::string &, uint16) but stores the string within the arena of \a result.
+ */
+void BinaryReader::readMultibyteTerminatedStringBE(ArenaString &result, uint16 termination)
+{
+    char delimChars[2];
+    BE::getBytes(termination, delimChars);
+    result.clear();
+    appendMultibyteTerminatedString(result, numeric_limits<size_t>::max(), delimChars);
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string from the current stream into \a result.
+ *
+ * Behaves like readMultibyteTerminatedStringLE(std::string &, uint16) but stores the string within the arena of \a result.
+ */
+void BinaryReader::readMultibyteTerminatedStringLE(ArenaString &result, uint16 termination)
+{
+    char delimChars[2];
+    LE::getBytes(termination, delimChars);
+    result.clear();
+    appendMultibyteTerminatedString(result, numeric_limits<size_t>::max(), delimChars);
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string from the current stream into \a result.
+ *
+ * Behaves like readMultibyteTerminatedStringBE(std::string &, std::size_t, uint16) but stores the string within the arena
+ * of \a result.
+ */
+void BinaryReader::readMultibyteTerminatedStringBE(ArenaString &result, std::size_t maxBytesToRead, uint16 termination)
+{
+    char delimChars[2];
+    BE::getBytes(termination, delimChars);
+    result.clear();
+    appendMultibyteTerminatedString(result, maxBytesToRead, delimChars);
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string from the current stream into \a result.
+ *
+ * Behaves like readMultibyteTerminatedStringLE(std::string &, std::size_t, uint16) but stores the string within the arena
+ * of \a result.
+ */
+void BinaryReader::readMultibyteTerminatedStringLE(ArenaString &result, std::size_t maxBytesToRead, uint16 termination)
+{
+    char delimChars[2];
+    LE::getBytes(termination, delimChars);
+    result.clear();
+    appendMultibyteTerminatedString(result, maxBytesToRead, delimChars);
+}
+
+/// \cond
+
+namespace {
+
+typedef const char *(*FindTerminatorFunction)(const char *begin, const char *end, char firstByte, char secondByte);
+
+/*!
+ * \brief The StreamBufferAccess struct provides access to the get area of a std::streambuf.
+ * \remarks The protected members are accessed via member pointers formed within the derived class.
+ */
+struct StreamBufferAccess : public streambuf
+{
+    static const char *begin(streambuf *buffer)
+    {
+        return (buffer->*&StreamBufferAccess::gptr)();
+    }
+    static const char *end(streambuf *buffer)
+    {
+        return (buffer->*&StreamBufferAccess::egptr)();
+    }
+    static void advance(streambuf *buffer, size_t count)
+    {
+        // not using gbump() because it takes an int which overflows for large get areas (eg. of a MappedFileBuffer)
+        char *const first = (buffer->*&StreamBufferAccess::eback)();
+        char *const next = (buffer->*&StreamBufferAccess::gptr)() + count;
+        (buffer->*&StreamBufferAccess::setg)(first, next, (buffer->*&StreamBufferAccess::egptr)());
+    }
+};
+
+/*!
+ * \brief Returns the first occurrence of the specified two bytes at an even offset within \a begin and \a end.
+ * \remarks The distance between \a begin and \a end must be even. Returns nullptr if there is no such occurrence.
+ */
+const char *findMultibyteTerminatorScalar(const char *begin, const char *end, char firstByte, char secondByte)
+{
+    for(; begin != end; begin += 2) {
+        if(begin[0] == firstByte && begin[1] == secondByte) {
+            return begin;
+        }
+    }
+    return nullptr;
+}
+
+#ifdef IOUTILITIES_X86_SIMD
+
+/*!
+ * \brief Returns the 16-bit value which is represented by the specified two bytes in memory on x86.
+ */
+inline short makeTerminatorValue(char firstByte, char secondByte)
+{
+    return static_cast<short>(static_cast<byte>(firstByte) | (static_cast<byte>(secondByte) << 8));
+}
+
+/*!
+ * \brief Returns the first occurrence of the specified two bytes at an even offset comparing 16 bytes at a time using SSE2.
+ */
+__attribute__((target("sse2"))) const char *findMultibyteTerminatorSse2(const char *begin, const char *end, char firstByte, char secondByte)
+{
+    const __m128i terminator = _mm_set1_epi16(makeTerminatorValue(firstByte, secondByte));
+    for(; end - begin >= 16; begin += 16) {
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        if(const int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(units, terminator))) {
+            return begin + __builtin_ctz(static_cast<unsigned int>(mask));
+        }
+    }
+    return findMultibyteTerminatorScalar(begin, end, firstByte, secondByte);
+}
+
+/*!
+ * \brief Returns the first occurrence of the specified two bytes at an even offset comparing 32 bytes at a time using AVX2.
+ */
+__attribute__((target("avx2"))) const char *findMultibyteTerminatorAvx2(const char *begin, const char *end, char firstByte, char secondByte)
+{
+    const __m256i terminator = _mm256_set1_epi16(makeTerminatorValue(firstByte, secondByte));
+    for(; end - begin >= 32; begin += 32) {
+        const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin));
+        if(const int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(units, terminator))) {
+            return begin + __builtin_ctz(static_cast<unsigned int>(mask));
+        }
+    }
+    return findMultibyteTerminatorSse2(begin, end, firstByte, secondByte);
+}
+
+#endif
+
+/*!
+ * \brief Returns the fastest implementation to find a multibyte terminator supported by the CPU.
+ */
+FindTerminatorFunction selectFindTerminatorFunction()
+{
+#ifdef IOUTILITIES_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        return &findMultibyteTerminatorAvx2;
+    }
+    if(__builtin_cpu_supports("sse2")) {
+        return &findMultibyteTerminatorSse2;
+    }
+#endif
+    return &findMultibyteTerminatorScalar;
+}
+
+/*!
+ * \brief Returns the first occurrence of the specified two bytes at an even offset within \a begin and \a end.
+ * \remarks Uses SIMD instructions if supported by the CPU (determined at runtime).
+ */
+const char *findMultibyteTerminator(const char *begin, const char *end, char firstByte, char secondByte)
+{
+    static const FindTerminatorFunction find = selectFindTerminatorFunction();
+    return find(begin, end, firstByte, secondByte);
+}
+
+}
+
+/*!
+ * \brief Reads the length prefix of a length prefixed string.
+ * \throws Throws ConversionException if the length denotation exceeds the maximum of 4 bytes.
+ */
+uint32 BinaryReader::readLengthPrefix()
+{
+    static const int maxPrefixLength = 4;
+    int prefixLength = 1;
+    byte beg = m_stream->peek();
+    byte mask = 0x80;
+    while(prefixLength <= maxPrefixLength && (beg & mask) == 0) {
+        ++prefixLength;
+        mask >>= 1;
+    }
+    if(prefixLength > maxPrefixLength) {
+        throw ConversionException("Length denotation of length-prefixed string exceeds maximum.");
+    }
+    memset(m_buffer, 0, maxPrefixLength);
+    read(m_buffer + (maxPrefixLength - prefixLength), prefixLength);
+    *(m_buffer + (maxPrefixLength - prefixLength)) ^= mask;
+    return BE::toUInt32(m_buffer);
+}
+
+/*!
+ * \brief Reads an unsigned LEB128 value and advances the current position of the stream by its length (1 to 10 bytes).
+ * \remarks
+ *  - LEB128 is used by eg. DWARF, WebAssembly and Protocol Buffers (where it is called varint).
+ *  - Sets the fail bit and the end-of-stream bit and returns zero if the end of the stream is reached prematurely.
+ * \throws Throws ConversionException if the value exceeds 64 bit.
+ * \sa ConversionUtilities::decodeULeb128()
+ */
+uint64 BinaryReader::readULeb128()
+{
+    char buffer[maxLeb128Size];
+    uint64 value = 0;
+    if(const size_t length = readLeb128Bytes(buffer)) {
+        decodeULeb128(buffer, buffer + length, value);
+    }
+    return value;
+}
+
+/*!
+ * \brief Reads a signed LEB128 value and advances the current position of the stream by its length (1 to 10 bytes).
+ * \remarks Sets the fail bit and the end-of-stream bit and returns zero if the end of the stream is reached prematurely.
+ * \throws Throws ConversionException if the value exceeds 64 bit.
+ * \sa ConversionUtilities::decodeSLeb128()
+ */
+int64 BinaryReader::readSLeb128()
+{
+    char buffer[maxLeb128Size];
+    int64 value = 0;
+    if(const size_t length = readLeb128Bytes(buffer)) {
+        decodeSLeb128(buffer, buffer + length, value);
+    }
+    return value;
+}
+
+/*!
+ * \brief Reads a zig-zag encoded unsigned LEB128 value and advances the current position of the stream by its length (1 to 10 bytes).
+ * \remarks This is how Protocol Buffers stores "sint64" fields.
+ * \throws Throws ConversionException if the value exceeds 64 bit.
+ * \sa ConversionUtilities::zigZagDecode()
+ */
+int64 BinaryReader::readZigZagLeb128()
+{
+    return zigZagDecode(readULeb128());
+}
+
+/*!
+ * \brief Reads an EBML variable size integer (VINT) and advances the current position of the stream by its length (1 to 8 bytes).
+ * \remarks
+ *  - VINTs with all data bits set (denoting elements of unknown size) are returned as ConversionUtilities::vIntUnknownSize.
+ *  - Sets the fail bit and the end-of-stream bit and returns zero if the end of the stream is reached prematurely.
+ * \throws Throws ConversionException if the first byte is zero (which would denote a length of more than 8 bytes).
+ * \sa ConversionUtilities::decodeVInt()
+ */
+uint64 BinaryReader::readVInt()
+{
+    read(m_buffer, 1);
+    if(m_stream->fail()) {
+        return 0;
+    }
+    const size_t length = vIntLength(m_buffer[0]);
+    if(!length) {
+        throw ConversionException("VINT exceeds maximum of 8 bytes.");
+    }
+    read(m_buffer + 1, static_cast<streamsize>(length - 1));
+    if(m_stream->fail()) {
+        return 0;
+    }
+    uint64 value;
+    decodeVInt(m_buffer, m_buffer + length, value);
+    return value;
+}
+
+/*!
+ * \brief Reads the bytes of an LEB128 value into \a buffer (which must provide ConversionUtilities::maxLeb128Size bytes).
+ *
+ * If the whole value is within the get area of the stream buffer (the common case), it is located and extracted at
+ * once. Otherwise the bytes are extracted one by one from the stream buffer.
+ *
+ * \returns Returns the number of bytes read or zero if the end of the stream has been reached prematurely.
+ * \remarks Stops after ConversionUtilities::maxLeb128Size bytes; decoding such a value throws ConversionException
+ *          if the last byte has still the continuation bit set.
+ */
+size_t BinaryReader::readLeb128Bytes(char *buffer)
+{
+    const istream::sentry sentry(*m_stream, true);
+    if(!sentry) {
+        return 0;
+    }
+    streambuf *const streamBuffer = m_stream->rdbuf();
+    const char *const begin = StreamBufferAccess::begin(streamBuffer);
+    const size_t available = min(static_cast<size_t>(StreamBufferAccess::end(streamBuffer) - begin), maxLeb128Size);
+    for(size_t length = 1; length <= available; ++length) {
+        if(!(begin[length - 1] & 0x80) || length == maxLeb128Size) {
+            memcpy(buffer, begin, length);
+            if(m_checksum) {
+                m_checksum->update(begin, length);
+            }
+            StreamBufferAccess::advance(streamBuffer, length);
+            return length;
         }
     }
-    return string(buff.get(), maxBytesToRead);
+    size_t length = 0;
+    do {
+        const auto character = streamBuffer->sbumpc();
+        if(char_traits<char>::eq_int_type(character, char_traits<char>::eof())) {
+            m_stream->setstate(ios_base::eofbit | ios_base::failbit);
+            return 0;
+        }
+        buffer[length] = char_traits<char>::to_char_type(character);
+        if(m_checksum) {
+            m_checksum->update(buffer + length, 1);
+        }
+    } while((buffer[length++] & 0x80) && length != maxLeb128Size);
+    return length;
 }
 
+/*!
+ * \brief Advances the current position of the stream by \a count bytes.
+ *
+ * The bytes are extracted via std::istream::ignore() so they are not copied. If a checksum is assigned, the bytes
+ * are read in chunks instead to update the checksum.
+ *
+ * \remarks Sets the fail bit and the end-of-stream bit if the end of the stream is reached prematurely (like read()).
+ */
+void BinaryReader::skipBytes(size_t count)
+{
+    if(!m_checksum) {
+        m_stream->ignore(static_cast<streamsize>(count));
+        if(static_cast<size_t>(m_stream->gcount()) != count) {
+            m_stream->setstate(ios_base::failbit);
+        }
+        return;
+    }
+    char buffer[0x1000];
+    for(size_t bytesToRead; count && m_stream->good(); count -= bytesToRead) {
+        bytesToRead = min(count, sizeof(buffer));
+        read(buffer, static_cast<streamsize>(bytesToRead));
+    }
+}
+
+/*!
+ * \brief Appends the bytes before the next occurrence of \a termination to \a result.
+ *
+ * Scans the get area of the stream buffer of the assigned stream chunk by chunk using memchr() instead of
+ * extracting each byte separately. The termination is extracted from the stream but not appended.
+ * At most \a maxBytesToRead bytes (including the termination) are extracted.
+ *
+ * \remarks Sets the fail bit and the end-of-stream bit if the end of the stream is reached before
+ *          the termination and before \a maxBytesToRead bytes have been extracted.
+ * \tparam StringType Specifies the type of \a result (std::string or MemoryUtilities::ArenaString).
+ */
+template<typename StringType>
+void BinaryReader::appendTerminatedString(StringType &result, size_t maxBytesToRead, byte termination)
+{
+    const istream::sentry sentry(*m_stream, true);
+    if(!sentry) {
+        return;
+    }
+    streambuf *const buffer = m_stream->rdbuf();
+    while(maxBytesToRead) {
+        const char *begin = StreamBufferAccess::begin(buffer), *end = StreamBufferAccess::end(buffer);
+        if(begin == end) {
+            if(char_traits<char>::eq_int_type(buffer->sgetc(), char_traits<char>::eof())) {
+                m_stream->setstate(ios_base::eofbit | ios_base::failbit);
+                return;
+            }
+            begin = StreamBufferAccess::begin(buffer);
+            end = StreamBufferAccess::end(buffer);
+            if(begin == end) {
+                // the stream buffer is unbuffered so extract the bytes one by one
+                const char c = char_traits<char>::to_char_type(buffer->sbumpc());
+                --maxBytesToRead;
+                if(m_checksum) {
+                    m_checksum->update(&c, 1);
+                }
+                if(static_cast<byte>(c) == termination) {
+                    return;
+                }
+                result.push_back(c);
+                continue;
+            }
+        }
+        const size_t chunkSize = min(static_cast<size_t>(end - begin), maxBytesToRead);
+        const auto *const delim = reinterpret_cast<const char *>(memchr(begin, termination, chunkSize));
+        const size_t bytesToExtract = delim ? static_cast<size_t>(delim - begin) + 1 : chunkSize;
+        result.append(begin, delim ? delim : begin + chunkSize);
+        if(m_checksum) {
+            m_checksum->update(begin, bytesToExtract);
+        }
+        StreamBufferAccess::advance(buffer, bytesToExtract);
+        maxBytesToRead -= bytesToExtract;
+        if(delim) {
+            return;
+        }
+    }
+}
+
+/*!
+ * \brief Appends the bytes before the next occurrence of the two bytes \a delimChars at an even offset to \a result.
+ *
+ * Scans the get area of the stream buffer of the assigned stream chunk by chunk comparing 16 or 32 bytes
+ * at a time. A code unit which is split between two chunks is completed when the next chunk is available.
+ * The termination is extracted from the stream but not appended. At most \a maxBytesToRead bytes (including the
+ * termination) are extracted.
+ *
+ * \remarks Sets the fail bit and the end-of-stream bit if the end of the stream is reached before
+ *          the termination and before \a maxBytesToRead bytes have been extracted.
+ * \tparam StringType Specifies the type of \a result (std::string or MemoryUtilities::ArenaString).
+ */
+template<typename StringType>
+void BinaryReader::appendMultibyteTerminatedString(StringType &result, size_t maxBytesToRead, const char *delimChars)
+{
+    const istream::sentry sentry(*m_stream, true);
+    if(!sentry) {
+        return;
+    }
+    streambuf *const buffer = m_stream->rdbuf();
+    char pendingByte = 0;
+    bool hasPendingByte = false; // whether the first byte of the current code unit has already been extracted
+    while(maxBytesToRead) {
+        const char *begin = StreamBufferAccess::begin(buffer), *end = StreamBufferAccess::end(buffer);
+        if(begin == end) {
+            if(char_traits<char>::eq_int_type(buffer->sgetc(), char_traits<char>::eof())) {
+                m_stream->setstate(ios_base::eofbit | ios_base::failbit);
+                break;
+            }
+            begin = StreamBufferAccess::begin(buffer);
+            end = StreamBufferAccess::end(buffer);
+            if(begin == end) {
+                // the stream buffer is unbuffered so extract the bytes one by one
+                const char c = char_traits<char>::to_char_type(buffer->sbumpc());
+                --maxBytesToRead;
+                if(m_checksum) {
+                    m_checksum->update(&c, 1);
+                }
+                if(!hasPendingByte) {
+                    pendingByte = c;
+                    hasPendingByte = true;
+                    continue;
+                }
+                hasPendingByte = false;
+                if(pendingByte == delimChars[0] && c == delimChars[1]) {
+                    return;
+                }
+                result.push_back(pendingByte);
+                result.push_back(c);
+                continue;
+            }
+        }
+        const char *const chunkEnd = begin + min(static_cast<size_t>(end - begin), maxBytesToRead);
+        const char *unitsBegin = begin;
+        if(hasPendingByte) {
+            // complete the code unit split between the previous and the current chunk
+            hasPendingByte = false;
+            ++unitsBegin;
+            if(pendingByte == delimChars[0] && *begin == delimChars[1]) {
+                if(m_checksum) {
+                    m_checksum->update(begin, 1);
+                }
+                StreamBufferAccess::advance(buffer, 1);
+                return;
+            }
+            result.push_back(pendingByte);
+            result.push_back(*begin);
+        }
+        const char *const unitsEnd = unitsBegin + (static_cast<size_t>(chunkEnd - unitsBegin) & ~static_cast<size_t>(1));
+        if(const char *const delim = findMultibyteTerminator(unitsBegin, unitsEnd, delimChars[0], delimChars[1])) {
+            result.append(unitsBegin, delim);
+            const size_t bytesToExtract = static_cast<size_t>(delim + 2 - begin);
+            if(m_checksum) {
+                m_checksum->update(begin, bytesToExtract);
+            }
+            StreamBufferAccess::advance(buffer, bytesToExtract);
+            return;
+        }
+        result.append(unitsBegin, unitsEnd);
+        if(unitsEnd != chunkEnd) {
+            pendingByte = *unitsEnd;
+            hasPendingByte = true;
+        }
+        const size_t bytesToExtract = static_cast<size_t>(chunkEnd - begin);
+        if(m_checksum) {
+            m_checksum->update(begin, bytesToExtract);
+        }
+        StreamBufferAccess::advance(buffer, bytesToExtract);
+        maxBytesToRead -= bytesToExtract;
+    }
+    if(hasPendingByte) {
+        result.push_back(pendingByte);
+    }
+}
+
+/// \endcond
+
 /*!
  * \brief Reads \a length bytes from the stream and computes the CRC-32 for that block of data.
  *
@@ -262,11 +887,14 @@ string BinaryReader::readMultibyteTerminatedStringLE(std::size_t maxBytesToRead,
  */
 uint32 BinaryReader::readCrc32(size_t length)
 {
-    uint32 crc = 0x00;
-    for(uint32 i = 0; i < length; ++i) {
-        crc = (crc << 8) ^ crc32Table[((crc >> 24) & 0xff) ^ static_cast<byte>(m_stream->get())];
+    char buffer[0x1000];
+    Crc32 crc;
+    for(size_t bytesToRead; length; length -= bytesToRead) {
+        bytesToRead = min(length, sizeof(buffer));
+        read(buffer, static_cast<streamsize>(bytesToRead));
+        crc.update(buffer, static_cast<size_t>(m_stream->gcount()));
     }
-    return crc;
+    return crc.value();
 }
 
 /*!
@@ -279,16 +907,12 @@ uint32 BinaryReader::readCrc32(size_t length)
  */
 uint32 BinaryReader::computeCrc32(const char *buffer, size_t length)
 {
-    uint32 crc = 0x00;
-    for(const char *i = buffer, *end = buffer + length; i != end; ++i) {
-        crc = (crc << 8) ^ crc32Table[((crc >> 24) & 0xff) ^ static_cast<byte>(*i)];
-    }
-    return crc;
+    return Crc32::compute(buffer, length);
 }
 
 /*!
  * \brief CRC-32 table.
- * \remarks Internally used by readCrc32() method.
+ * \remarks Internally used by readCrc32() method. The table is also the first table used by Crc32 for slicing-by-16.
  * \sa readCrc32()
  */
 const uint32 BinaryReader::crc32Table[] = {
@@ -1,12 +1,26 @@
 #ifndef IOUTILITIES_BINERYREADER_H
 #define IOUTILITIES_BINERYREADER_H
 
+#include "./checksum.h"
+
 #include "../conversion/binaryconversion.h"
 
 #include <vector>
 #include <string>
 #include <istream>
 
+namespace ConversionUtilities
+{
+template<typename... Fields> struct BinaryRecord;
+}
+
+namespace MemoryUtilities
+{
+class MonotonicArena;
+template<typename T> class ArenaAllocator;
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char> > ArenaString;
+}
+
 namespace IoUtilities
 {
 class CPP_UTILITIES_EXPORT BinaryReader
@@ -24,6 +38,8 @@ public:
     bool hasOwnership() const;
     void giveOwnership();
     void detatchOwnership();
+    Checksum *checksum() const;
+    void setChecksum(Checksum *checksum);
     bool fail() const;
     bool eof() const;
     bool canRead() const;
@@ -31,6 +47,7 @@ public:
     void read(char *buffer, std::streamsize length);
     void read(byte *buffer, std::streamsize length);
     void read(std::vector<char> &buffer, std::streamsize length);
+    void read(std::vector<char, MemoryUtilities::ArenaAllocator<char> > &buffer, std::streamsize length);
     int16 readInt16BE();
     uint16 readUInt16BE();
     int32 readInt24BE();
@@ -59,6 +76,22 @@ public:
     uint64 readUInt64LE();
     float32 readFloat32LE();
     float64 readFloat64LE();
+    void readInt16BE(int16 *values, std::size_t count);
+    void readUInt16BE(uint16 *values, std::size_t count);
+    void readInt32BE(int32 *values, std::size_t count);
+    void readUInt32BE(uint32 *values, std::size_t count);
+    void readInt64BE(int64 *values, std::size_t count);
+    void readUInt64BE(uint64 *values, std::size_t count);
+    void readFloat32BE(float32 *values, std::size_t count);
+    void readFloat64BE(float64 *values, std::size_t count);
+    void readInt16LE(int16 *values, std::size_t count);
+    void readUInt16LE(uint16 *values, std::size_t count);
+    void readInt32LE(int32 *values, std::size_t count);
+    void readUInt32LE(uint32 *values, std::size_t count);
+    void readInt64LE(int64 *values, std::size_t count);
+    void readUInt64LE(uint64 *values, std::size_t count);
+    void readFloat32LE(float32 *values, std::size_t count);
+    void readFloat64LE(float64 *values, std::size_t count);
     char readChar();
     byte readByte();
     bool readBool();
@@ -70,20 +103,50 @@ public:
     std::string readMultibyteTerminatedStringLE(uint16 termination = 0);
     std::string readMultibyteTerminatedStringBE(std::size_t maxBytesToRead, uint16 termination = 0);
     std::string readMultibyteTerminatedStringLE(std::size_t maxBytesToRead, uint16 termination = 0);
+    void readLengthPrefixedString(std::string &result);
+    void readString(std::string &result, std::size_t length);
+    void readTerminatedString(std::string &result, byte termination = 0);
+    void readTerminatedString(std::string &result, std::size_t maxBytesToRead, byte termination = 0);
+    void readMultibyteTerminatedStringBE(std::string &result, uint16 termination = 0);
+    void readMultibyteTerminatedStringLE(std::string &result, uint16 termination = 0);
+    void readMultibyteTerminatedStringBE(std::string &result, std::size_t maxBytesToRead, uint16 termination = 0);
+    void readMultibyteTerminatedStringLE(std::string &result, std::size_t maxBytesToRead, uint16 termination = 0);
+    void readLengthPrefixedString(MemoryUtilities::ArenaString &result);
+    void readString(MemoryUtilities::ArenaString &result, std::size_t length);
+    void readTerminatedString(MemoryUtilities::ArenaString &result, byte termination = 0);
+    void readTerminatedString(MemoryUtilities::ArenaString &result, std::size_t maxBytesToRead, byte termination = 0);
+    void readMultibyteTerminatedStringBE(MemoryUtilities::ArenaString &result, uint16 termination = 0);
+    void readMultibyteTerminatedStringLE(MemoryUtilities::ArenaString &result, uint16 termination = 0);
+    void readMultibyteTerminatedStringBE(MemoryUtilities::ArenaString &result, std::size_t maxBytesToRead, uint16 termination = 0);
+    void readMultibyteTerminatedStringLE(MemoryUtilities::ArenaString &result, std::size_t maxBytesToRead, uint16 termination = 0);
+    void skipLengthPrefixedString();
     uint32 readSynchsafeUInt32BE();
     float32 readFixed8BE();
     float32 readFixed16BE();
     uint32 readSynchsafeUInt32LE();
     float32 readFixed8LE();
     float32 readFixed16LE();
+    uint64 readULeb128();
+    int64 readSLeb128();
+    int64 readZigZagLeb128();
+    uint64 readVInt();
+    template<typename Record, typename Tuple> void readRecord(Tuple &&values);
+    template<typename Record> typename Record::ValueTuple readRecord();
     uint32 readCrc32(std::size_t length);
     static uint32 computeCrc32(const char *buffer, std::size_t length);
     static const uint32 crc32Table[];
 
 private:
+    uint32 readLengthPrefix();
+    std::size_t readLeb128Bytes(char *buffer);
+    void skipBytes(std::size_t count);
+    template<typename StringType> void appendTerminatedString(StringType &result, std::size_t maxBytesToRead, byte termination);
+    template<typename StringType> void appendMultibyteTerminatedString(StringType &result, std::size_t maxBytesToRead, const char *delimChars);
+
     std::istream *m_stream;
     bool m_ownership;
     char m_buffer[8];
+    Checksum *m_checksum;
 };
 
 /*!
@@ -144,6 +207,29 @@ inline void BinaryReader::detatchOwnership()
     m_ownership = false;
 }
 
+/*!
+ * \brief Returns the checksum which is updated with all data read (if any).
+ * \sa setChecksum()
+ */
+inline Checksum *BinaryReader::checksum() const
+{
+    return m_checksum;
+}
+
+/*!
+ * \brief Assigns a \a checksum which is updated with all data read until another checksum (or nullptr) is assigned.
+ *
+ * This allows computing the checksum of a region while reading its contents (see Checksum for an example).
+ *
+ * \remarks
+ *  - Does not take ownership over the specified \a checksum.
+ *  - Data which is skipped by seeking the stream directly is not taken into account.
+ */
+inline void BinaryReader::setChecksum(Checksum *checksum)
+{
+    m_checksum = checksum;
+}
+
 /*!
  * \brief Returns an indication whether the fail bit of the assigned stream is set.
  */
@@ -170,10 +256,14 @@ inline bool BinaryReader::canRead() const
 
 /*!
  * \brief Reads the specified number of characters from the stream in the character array.
+ * \remarks All read-methods read via this method so the assigned checksum (if any) is updated here.
  */
 inline void BinaryReader::read(char *buffer, std::streamsize length)
 {
     m_stream->read(buffer, length);
+    if(m_checksum) {
+        m_checksum->update(buffer, static_cast<std::size_t>(m_stream->gcount()));
+    }
 }
 
 /*!
@@ -181,7 +271,7 @@ inline void BinaryReader::read(char *buffer, std::streamsize length)
  */
 inline void BinaryReader::read(byte *buffer, std::streamsize length)
 {
-    m_stream->read(reinterpret_cast<char *>(buffer), length);
+    read(reinterpret_cast<char *>(buffer), length);
 }
 
 /*!
@@ -190,7 +280,7 @@ inline void BinaryReader::read(byte *buffer, std::streamsize length)
 inline void BinaryReader::read(std::vector<char> &buffer, std::streamsize length)
 {
     buffer.resize(length);
-    m_stream->read(buffer.data(), length);
+    read(buffer.data(), length);
 }
 
 /*!
@@ -198,7 +288,7 @@ inline void BinaryReader::read(std::vector<char> &buffer, std::streamsize length
  */
 inline int16 BinaryReader::readInt16BE()
 {
-    m_stream->read(m_buffer, sizeof(int16));
+    read(m_buffer, sizeof(int16));
     return ConversionUtilities::BE::toInt16(m_buffer);
 }
 
@@ -207,7 +297,7 @@ inline int16 BinaryReader::readInt16BE()
  */
 inline uint16 BinaryReader::readUInt16BE()
 {
-    m_stream->read(m_buffer, sizeof(uint16));
+    read(m_buffer, sizeof(uint16));
     return ConversionUtilities::BE::toUInt16(m_buffer);
 }
 
@@ -216,13 +306,8 @@ inline uint16 BinaryReader::readUInt16BE()
  */
 inline int32 BinaryReader::readInt24BE()
 {
-    *m_buffer = 0;
-    m_stream->read(m_buffer + 1, 3);
-    auto val = ConversionUtilities::BE::toInt32(m_buffer);
-    if(val >= 0x800000) {
-        val = -(0x1000000 - val);
-    }
-    return val;
+    read(m_buffer, 3);
+    return ConversionUtilities::BE::toInt24(m_buffer);
 }
 
 /*!
@@ -230,9 +315,8 @@ inline int32 BinaryReader::readInt24BE()
  */
 inline uint32 BinaryReader::readUInt24BE()
 {
-    *m_buffer = 0;
-    m_stream->read(m_buffer + 1, 3);
-    return ConversionUtilities::BE::toUInt32(m_buffer);
+    read(m_buffer, 3);
+    return ConversionUtilities::BE::toUInt24(m_buffer);
 }
 
 /*!
@@ -240,7 +324,7 @@ inline uint32 BinaryReader::readUInt24BE()
  */
 inline int32 BinaryReader::readInt32BE()
 {
-    m_stream->read(m_buffer, sizeof(int32));
+    read(m_buffer, sizeof(int32));
     return ConversionUtilities::BE::toInt32(m_buffer);
 }
 
@@ -249,7 +333,7 @@ inline int32 BinaryReader::readInt32BE()
  */
 inline uint32 BinaryReader::readUInt32BE()
 {
-    m_stream->read(m_buffer, sizeof(uint32));
+    read(m_buffer, sizeof(uint32));
     return ConversionUtilities::BE::toUInt32(m_buffer);
 }
 
@@ -258,13 +342,8 @@ inline uint32 BinaryReader::readUInt32BE()
  */
 inline int64 BinaryReader::readInt40BE()
 {
-    *m_buffer = *(m_buffer + 1) = *(m_buffer + 2) = 0;
-    m_stream->read(m_buffer + 3, 5);
-    auto val = ConversionUtilities::BE::toInt64(m_buffer);
-    if(val >= 0x8000000000) {
-        val = -(0x10000000000 - val);
-    }
-    return val;
+    read(m_buffer, 5);
+    return ConversionUtilities::BE::toInt40(m_buffer);
 }
 
 /*!
@@ -272,9 +351,8 @@ inline int64 BinaryReader::readInt40BE()
  */
 inline uint64 BinaryReader::readUInt40BE()
 {
-    *m_buffer = *(m_buffer + 1) = *(m_buffer + 2) = 0;
-    m_stream->read(m_buffer + 3, 5);
-    return ConversionUtilities::BE::toUInt64(m_buffer);
+    read(m_buffer, 5);
+    return ConversionUtilities::BE::toUInt40(m_buffer);
 }
 
 /*!
@@ -282,13 +360,8 @@ inline uint64 BinaryReader::readUInt40BE()
  */
 inline int64 BinaryReader::readInt56BE()
 {
-    *m_buffer = 0;
-    m_stream->read(m_buffer + 1, 7);
-    auto val = ConversionUtilities::BE::toInt64(m_buffer);
-    if(val >= 0x80000000000000) {
-        val = -(0x100000000000000 - val);
-    }
-    return val;
+    read(m_buffer, 7);
+    return ConversionUtilities::BE::toInt56(m_buffer);
 }
 
 /*!
@@ -296,9 +369,8 @@ inline int64 BinaryReader::readInt56BE()
  */
 inline uint64 BinaryReader::readUInt56BE()
 {
-    *m_buffer = 0;
-    m_stream->read(m_buffer + 1, 7);
-    return ConversionUtilities::BE::toUInt64(m_buffer);
+    read(m_buffer, 7);
+    return ConversionUtilities::BE::toUInt56(m_buffer);
 }
 
 /*!
@@ -306,7 +378,7 @@ inline uint64 BinaryReader::readUInt56BE()
  */
 inline int64 BinaryReader::readInt64BE()
 {
-    m_stream->read(m_buffer, sizeof(int64));
+    read(m_buffer, sizeof(int64));
     return ConversionUtilities::BE::toInt64(m_buffer);
 }
 
@@ -315,7 +387,7 @@ inline int64 BinaryReader::readInt64BE()
  */
 inline uint64 BinaryReader::readUInt64BE()
 {
-    m_stream->read(m_buffer, sizeof(uint64));
+    read(m_buffer, sizeof(uint64));
     return ConversionUtilities::BE::toUInt64(m_buffer);
 }
 
@@ -324,7 +396,7 @@ inline uint64 BinaryReader::readUInt64BE()
  */
 inline float32 BinaryReader::readFloat32BE()
 {
-    m_stream->read(m_buffer, sizeof(float32));
+    read(m_buffer, sizeof(float32));
     return ConversionUtilities::BE::toFloat32(m_buffer);
 }
 
@@ -333,7 +405,7 @@ inline float32 BinaryReader::readFloat32BE()
  */
 inline float64 BinaryReader::readFloat64BE()
 {
-    m_stream->read(m_buffer, sizeof(float64));
+    read(m_buffer, sizeof(float64));
     return ConversionUtilities::BE::toFloat64(m_buffer);
 }
 
@@ -342,7 +414,7 @@ inline float64 BinaryReader::readFloat64BE()
  */
 inline int16 BinaryReader::readInt16LE()
 {
-    m_stream->read(m_buffer, sizeof(int16));
+    read(m_buffer, sizeof(int16));
     return ConversionUtilities::LE::toInt16(m_buffer);
 }
 
@@ -351,7 +423,7 @@ inline int16 BinaryReader::readInt16LE()
  */
 inline uint16 BinaryReader::readUInt16LE()
 {
-    m_stream->read(m_buffer, sizeof(uint16));
+    read(m_buffer, sizeof(uint16));
     return ConversionUtilities::LE::toUInt16(m_buffer);
 }
 
@@ -360,13 +432,8 @@ inline uint16 BinaryReader::readUInt16LE()
  */
 inline int32 BinaryReader::readInt24LE()
 {
-    *(m_buffer + 3) = 0;
-    m_stream->read(m_buffer, 3);
-    auto val = ConversionUtilities::LE::toInt32(m_buffer);
-    if(val >= 0x800000) {
-        val = -(0x1000000 - val);
-    }
-    return val;
+    read(m_buffer, 3);
+    return ConversionUtilities::LE::toInt24(m_buffer);
 }
 
 /*!
@@ -374,9 +441,8 @@ inline int32 BinaryReader::readInt24LE()
  */
 inline uint32 BinaryReader::readUInt24LE()
 {
-    *(m_buffer + 3) = 0;
-    m_stream->read(m_buffer, 3);
-    return ConversionUtilities::LE::toUInt32(m_buffer);
+    read(m_buffer, 3);
+    return ConversionUtilities::LE::toUInt24(m_buffer);
 }
 
 /*!
@@ -384,7 +450,7 @@ inline uint32 BinaryReader::readUInt24LE()
  */
 inline int32 BinaryReader::readInt32LE()
 {
-    m_stream->read(m_buffer, sizeof(int32));
+    read(m_buffer, sizeof(int32));
     return ConversionUtilities::LE::toInt32(m_buffer);
 }
 
@@ -393,7 +459,7 @@ inline int32 BinaryReader::readInt32LE()
  */
 inline uint32 BinaryReader::readUInt32LE()
 {
-    m_stream->read(m_buffer, sizeof(uint32));
+    read(m_buffer, sizeof(uint32));
     return ConversionUtilities::LE::toUInt32(m_buffer);
 }
 
@@ -402,13 +468,8 @@ inline uint32 BinaryReader::readUInt32LE()
  */
 inline int64 BinaryReader::readInt40LE()
 {
-    *(m_buffer + 5) = *(m_buffer + 6) = *(m_buffer + 7) = 0;
-    m_stream->read(m_buffer, 5);
-    auto val = ConversionUtilities::LE::toInt64(m_buffer);
-    if(val >= 0x8000000000) {
-        val = -(0x10000000000 - val);
-    }
-    return val;
+    read(m_buffer, 5);
+    return ConversionUtilities::LE::toInt40(m_buffer);
 }
 
 /*!
@@ -416,9 +477,8 @@ inline int64 BinaryReader::readInt40LE()
  */
 inline uint64 BinaryReader::readUInt40LE()
 {
-    *(m_buffer + 5) = *(m_buffer + 6) = *(m_buffer + 7) = 0;
-    m_stream->read(m_buffer, 5);
-    return ConversionUtilities::LE::toUInt64(m_buffer);
+    read(m_buffer, 5);
+    return ConversionUtilities::LE::toUInt40(m_buffer);
 }
 
 /*!
@@ -426,13 +486,8 @@ inline uint64 BinaryReader::readUInt40LE()
  */
 inline int64 BinaryReader::readInt56LE()
 {
-    *(m_buffer + 7) = 0;
-    m_stream->read(m_buffer, 7);
-    auto val = ConversionUtilities::LE::toInt64(m_buffer);
-    if(val >= 0x80000000000000) {
-        val = -(0x100000000000000 - val);
-    }
-    return val;
+    read(m_buffer, 7);
+    return ConversionUtilities::LE::toInt56(m_buffer);
 }
 
 /*!
@@ -440,9 +495,8 @@ inline int64 BinaryReader::readInt56LE()
  */
 inline uint64 BinaryReader::readUInt56LE()
 {
-    *(m_buffer + 7) = 0;
-    m_stream->read(m_buffer, 7);
-    return ConversionUtilities::LE::toUInt64(m_buffer);
+    read(m_buffer, 7);
+    return ConversionUtilities::LE::toUInt56(m_buffer);
 }
 
 /*!
@@ -450,7 +504,7 @@ inline uint64 BinaryReader::readUInt56LE()
  */
 inline int64 BinaryReader::readInt64LE()
 {
-    m_stream->read(m_buffer, sizeof(int64));
+    read(m_buffer, sizeof(int64));
     return ConversionUtilities::LE::toInt64(m_buffer);
 }
 
@@ -459,7 +513,7 @@ inline int64 BinaryReader::readInt64LE()
  */
 inline uint64 BinaryReader::readUInt64LE()
 {
-    m_stream->read(m_buffer, sizeof(uint64));
+    read(m_buffer, sizeof(uint64));
     return ConversionUtilities::LE::toUInt64(m_buffer);
 }
 
@@ -468,7 +522,7 @@ inline uint64 BinaryReader::readUInt64LE()
  */
 inline float32 BinaryReader::readFloat32LE()
 {
-    m_stream->read(m_buffer, sizeof(float32));
+    read(m_buffer, sizeof(float32));
     return ConversionUtilities::LE::toFloat32(m_buffer);
 }
 
@@ -477,16 +531,176 @@ inline float32 BinaryReader::readFloat32LE()
  */
 inline float64 BinaryReader::readFloat64LE()
 {
-    m_stream->read(m_buffer, sizeof(float64));
+    read(m_buffer, sizeof(float64));
     return ConversionUtilities::LE::toFloat64(m_buffer);
 }
 
+/*!
+ * \brief Reads \a count 16-bit big endian signed integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readInt16BE(int16 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(int16)));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint16 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit big endian unsigned integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readUInt16BE(uint16 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(uint16)));
+    ConversionUtilities::BE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian signed integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readInt32BE(int32 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(int32)));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint32 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian unsigned integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readUInt32BE(uint32 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(uint32)));
+    ConversionUtilities::BE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian signed integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readInt64BE(int64 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(int64)));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint64 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian unsigned integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readUInt64BE(uint64 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(uint64)));
+    ConversionUtilities::BE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian floating point values from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readFloat32BE(float32 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(float32)));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint32 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian floating point values from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readFloat64BE(float64 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(float64)));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint64 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit little endian signed integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readInt16LE(int16 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(int16)));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint16 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit little endian unsigned integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readUInt16LE(uint16 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(uint16)));
+    ConversionUtilities::LE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian signed integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readInt32LE(int32 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(int32)));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint32 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian unsigned integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readUInt32LE(uint32 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(uint32)));
+    ConversionUtilities::LE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian signed integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readInt64LE(int64 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(int64)));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint64 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian unsigned integers from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readUInt64LE(uint64 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(uint64)));
+    ConversionUtilities::LE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian floating point values from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readFloat32LE(float32 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(float32)));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint32 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian floating point values from the current stream into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BinaryReader::readFloat64LE(float64 *values, std::size_t count)
+{
+    read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(float64)));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint64 *>(values), count);
+}
+
 /*!
  * \brief Reads a single character from the current stream and advances the current position of the stream by one byte.
  */
 inline char BinaryReader::readChar()
 {
-    m_stream->read(m_buffer, sizeof(char));
+    read(m_buffer, sizeof(char));
     return m_buffer[0];
 }
 
@@ -495,7 +709,7 @@ inline char BinaryReader::readChar()
  */
 inline byte BinaryReader::readByte()
 {
-    m_stream->read(m_buffer, sizeof(char));
+    read(m_buffer, sizeof(char));
     return static_cast<byte>(m_buffer[0]);
 }
 
@@ -560,6 +774,46 @@ inline float32 BinaryReader::readFixed16LE()
     return ConversionUtilities::toFloat32(readUInt32LE());
 }
 
+
+/*!
+ * \brief Reads a record of the specified type into \a values and advances the current position of the stream by the size of the record.
+ *
+ * The whole record is read at once and decoded afterwards so reading a header with many fields requires only a single
+ * call on the stream:
+ * \code
+ * typedef BinaryRecord<BEField<uint32>, LEField<uint16>, BEField<int32, 3>> Header;
+ * uint32 magic;
+ * uint16 version;
+ * int32 offset;
+ * reader.readRecord<Header>(std::tie(magic, version, offset));
+ * \endcode
+ *
+ * \tparam Record Specifies the ConversionUtilities::BinaryRecord to be read.
+ * \param values Specifies a tuple with one element per field, eg. a tuple of references created via std::tie().
+ * \remarks The values are decoded even if the end of the stream is reached prematurely (missing bytes are read as zero).
+ *          Check fail() to detect that case.
+ */
+template<typename Record, typename Tuple>
+void BinaryReader::readRecord(Tuple &&values)
+{
+    char buffer[Record::size] = {};
+    read(buffer, static_cast<std::streamsize>(Record::size));
+    Record::decode(buffer, values);
+}
+
+/*!
+ * \brief Reads a record of the specified type and advances the current position of the stream by the size of the record.
+ * \tparam Record Specifies the ConversionUtilities::BinaryRecord to be read.
+ * \returns Returns the values of the fields as tuple.
+ */
+template<typename Record>
+typename Record::ValueTuple BinaryReader::readRecord()
+{
+    typename Record::ValueTuple values;
+    readRecord<Record>(values);
+    return values;
+}
+
 }
 
 #endif // IOUTILITIES_BINERYREADER_H
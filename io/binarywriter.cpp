@@ -1,18 +1,54 @@
 #include "./binarywriter.h"
 
 #include "../conversion/conversionexception.h"
+#include "../misc/memory.h"
 
 #include <cstring>
+#include <algorithm>
 #include <memory>
 
 using namespace std;
 using namespace IoUtilities;
 using namespace ConversionUtilities;
 
+/// \cond
+
+namespace {
+
+/*!
+ * \brief Specifies the size of the buffer used to convert arrays before writing them.
+ */
+constexpr size_t stagingBufferSize = 0x4000;
+
+/*!
+ * \brief Writes the specified \a values using the specified \a writer swapping the byte order if \a swap is true.
+ */
+template<typename Type>
+void writeArrayToStream(BinaryWriter &writer, const Type *values, size_t count, bool swap)
+{
+    if(!swap) {
+        writer.write(reinterpret_cast<const char *>(values), static_cast<streamsize>(count * sizeof(Type)));
+        return;
+    }
+    Type buffer[stagingBufferSize / sizeof(Type)];
+    for(size_t chunkSize; count; count -= chunkSize, values += chunkSize) {
+        chunkSize = min(count, stagingBufferSize / sizeof(Type));
+        memcpy(buffer, values, chunkSize * sizeof(Type));
+        swapOrder(buffer, chunkSize);
+        writer.write(reinterpret_cast<const char *>(buffer), static_cast<streamsize>(chunkSize * sizeof(Type)));
+    }
+}
+
+}
+
+/// \endcond
+
 /*!
  * \class IoUtilities::BinaryWriter
  * \brief Writes primitive data types to a std::ostream.
- * \remarks Supports both, little endian and big endian.
+ * \remarks
+ *  - Supports both, little endian and big endian.
+ *  - Small writes can be combined using an internal buffer, see setBufferSize().
  */
 
 /*!
@@ -21,23 +57,37 @@ using namespace ConversionUtilities;
  */
 BinaryWriter::BinaryWriter(ostream *stream) :
     m_stream(stream),
-    m_ownership(false)
+    m_ownership(false),
+    m_outputBufferSize(0),
+    m_outputBufferPos(0),
+    m_outputBufferOffset(-1),
+    m_checksum(nullptr)
 {}
 
 /*!
  * \brief Copies the specified BinaryWriter.
- * \remarks The copy will not take ownership over the stream.
+ * \remarks The copy will not take ownership over the stream, does not buffer writes and does not update the checksum.
  */
 BinaryWriter::BinaryWriter(const BinaryWriter &other) :
     m_stream(other.m_stream),
-    m_ownership(false)
+    m_ownership(false),
+    m_outputBufferSize(0),
+    m_outputBufferPos(0),
+    m_outputBufferOffset(-1),
+    m_checksum(nullptr)
 {}
 
 /*!
  * \brief Destroys the BinaryWriter.
+ * \remarks Buffered data is written to the assigned stream before. IO errors which occur
+ *          when doing so are ignored; call flush() before to handle them.
  */
 BinaryWriter::~BinaryWriter()
 {
+    try {
+        writeBufferedData();
+    } catch(...) {
+    }
     if(m_ownership) {
         delete m_stream;
     }
@@ -52,10 +102,12 @@ BinaryWriter::~BinaryWriter()
  * \param stream Specifies the stream to be assigned.
  * \param giveOwnership Indicated whether the reader should take ownership (default is false).
  *
+ * \remarks Buffered data is written to the previously assigned stream before.
  * \sa setStream()
  */
 void BinaryWriter::setStream(ostream *stream, bool giveOwnership)
 {
+    writeBufferedData();
     if(m_ownership) {
         delete m_stream;
     }
@@ -68,6 +120,111 @@ void BinaryWriter::setStream(ostream *stream, bool giveOwnership)
     }
 }
 
+/*!
+ * \brief Sets the size of the internal write-combining buffer.
+ *
+ * If the size is greater than zero, data passed to the write-methods is collected in the internal buffer and
+ * only written to the assigned stream when the buffer is full, flush() is called, another stream is assigned
+ * or the writer is destroyed. This reduces the number of calls to std::ostream::write() when writing many
+ * small values. Writes which do not fit into the buffer anyways are passed to the stream directly.
+ *
+ * Specifying zero disables buffering (the default).
+ *
+ * \remarks
+ *  - Buffered data is written to the stream before the buffer is resized.
+ *  - The assigned stream must not be written to directly (or repositioned) while data is buffered.
+ */
+void BinaryWriter::setBufferSize(size_t bufferSize)
+{
+    writeBufferedData();
+    if(bufferSize) {
+        m_outputBuffer = make_unique<char[]>(bufferSize);
+    } else {
+        m_outputBuffer.reset();
+    }
+    m_outputBufferSize = bufferSize;
+}
+
+/*!
+ * \brief Returns the current position of the stream taking data which is still buffered into account.
+ *
+ * The returned position can be passed to patch() to overwrite data which will be written after calling this method.
+ *
+ * \remarks When buffering is enabled, the position of the stream is only queried once per buffered block. The
+ *          queried position is only kept while data is buffered because the stream might be written to directly
+ *          or repositioned as soon as the buffer has been written.
+ */
+ostream::pos_type BinaryWriter::position()
+{
+    if(!m_outputBufferPos) {
+        return m_stream->tellp();
+    }
+    if(m_outputBufferOffset < 0) {
+        const auto streamPosition = m_stream->tellp();
+        if(streamPosition < 0) {
+            return streamPosition;
+        }
+        m_outputBufferOffset = static_cast<streamoff>(streamPosition);
+    }
+    return m_outputBufferOffset + static_cast<streamoff>(m_outputBufferPos);
+}
+
+/*!
+ * \brief Overwrites \a length bytes previously written at the specified \a position with the data from \a buffer.
+ *
+ * This is useful to fill in a length denotation after writing the data it refers to. The \a position can be determined
+ * using position() before writing the placeholder.
+ *
+ * If the affected region is still held by the internal buffer, it is patched in memory. Otherwise the stream is seeked to
+ * \a position, the data is written and the stream is seeked back.
+ */
+void BinaryWriter::patch(ostream::pos_type position, const char *buffer, size_t length)
+{
+    const auto offset = static_cast<streamoff>(position);
+    if(m_outputBufferPos && static_cast<streamoff>(this->position()) >= 0 && offset >= m_outputBufferOffset
+            && static_cast<size_t>(offset - m_outputBufferOffset) + length <= m_outputBufferPos) {
+        memcpy(m_outputBuffer.get() + (offset - m_outputBufferOffset), buffer, length);
+        return;
+    }
+    writeBufferedData();
+    const auto currentPosition = m_stream->tellp();
+    m_stream->seekp(position);
+    m_stream->write(buffer, static_cast<streamsize>(length));
+    m_stream->seekp(currentPosition);
+}
+
+/*!
+ * \brief Writes the specified data which does not fit into the remaining space of the internal buffer.
+ *
+ * Writes the buffered data to the stream. Then the specified data is either buffered or written to the stream
+ * directly if it is too big for the buffer.
+ */
+void BinaryWriter::writeBuffered(const char *buffer, size_t length)
+{
+    writeBufferedData();
+    if(length < m_outputBufferSize) {
+        memcpy(m_outputBuffer.get(), buffer, length);
+        m_outputBufferPos = length;
+    } else {
+        m_stream->write(buffer, static_cast<streamsize>(length));
+    }
+}
+
+/*!
+ * \brief Writes the data held by the internal buffer to the stream (if any).
+ * \remarks Invalidates the position of the buffered block determined by position().
+ */
+void BinaryWriter::writeBufferedData()
+{
+    m_outputBufferOffset = -1;
+    if(!m_outputBufferPos) {
+        return;
+    }
+    const auto length = m_outputBufferPos;
+    m_outputBufferPos = 0;
+    m_stream->write(m_outputBuffer.get(), static_cast<streamsize>(length));
+}
+
 /*!
  * \brief Writes the length of a string and the string itself to the current stream.
  *
@@ -78,18 +235,60 @@ void BinaryWriter::writeLengthPrefixedString(const string &value)
     size_t length = value.length();
     if(length < 0x80) {
         m_buffer[0] = 0x80 | length;
-        m_stream->write(m_buffer, 1);
+        write(m_buffer, 1);
     } else if(length < 0x4000) {
         BE::getBytes(static_cast<uint16>(0x4000 | length), m_buffer);
-        m_stream->write(m_buffer, 2);
+        write(m_buffer, 2);
     } else if(length < 0x200000) {
         BE::getBytes(static_cast<uint32>(0x200000 | length), m_buffer);
-        m_stream->write(m_buffer + 1, 3);
+        write(m_buffer + 1, 3);
     } else if(length < 0x10000000) {
         BE::getBytes(static_cast<uint32>(0x10000000 | length), m_buffer);
-        m_stream->write(m_buffer, 4);
+        write(m_buffer, 4);
     } else {
         throw ConversionException("The size of the string exceeds the maximum.");
     }
-    m_stream->write(value.c_str(), length);
+    write(value.c_str(), length);
+}
+
+/*!
+ * \brief Writes the specified \a values as unsigned LEB128 and advances the current position of the stream by their total length.
+ *
+ * The values are encoded into a staging buffer first which is then written at once instead of writing each value
+ * separately.
+ */
+void BinaryWriter::writeULeb128(const uint64 *values, size_t count)
+{
+    char buffer[stagingBufferSize];
+    for(const uint64 *end = values + count; values != end;) {
+        char *i = buffer;
+        for(const char *const chunkEnd = buffer + stagingBufferSize - maxLeb128Size; values != end && i <= chunkEnd; ++values) {
+            i += encodeULeb128(*values, i);
+        }
+        write(buffer, static_cast<streamsize>(i - buffer));
+    }
+}
+
+/*!
+ * \brief Writes the specified 16-bit \a values swapping the byte order if \a swapOrder is true.
+ */
+void BinaryWriter::writeArray(const uint16 *values, size_t count, bool swapOrder)
+{
+    writeArrayToStream(*this, values, count, swapOrder);
+}
+
+/*!
+ * \brief Writes the specified 32-bit \a values swapping the byte order if \a swapOrder is true.
+ */
+void BinaryWriter::writeArray(const uint32 *values, size_t count, bool swapOrder)
+{
+    writeArrayToStream(*this, values, count, swapOrder);
+}
+
+/*!
+ * \brief Writes the specified 64-bit \a values swapping the byte order if \a swapOrder is true.
+ */
+void BinaryWriter::writeArray(const uint64 *values, size_t count, bool swapOrder)
+{
+    writeArrayToStream(*this, values, count, swapOrder);
 }
@@ -1,12 +1,18 @@
 #ifndef IOUTILITIES_BINARYWRITER_H
 #define IOUTILITIES_BINARYWRITER_H
 
+#include "./checksum.h"
+
 #include "../conversion/types.h"
 #include "../conversion/binaryconversion.h"
+#include "../conversion/binaryrecord.h"
+#include "../conversion/varint.h"
 
 #include <vector>
 #include <string>
 #include <ostream>
+#include <memory>
+#include <cstring>
 
 namespace IoUtilities
 {
@@ -25,7 +31,20 @@ public:
     bool hasOwnership() const;
     void giveOwnership();
     void detatchOwnership();
+    Checksum *checksum() const;
+    void setChecksum(Checksum *checksum);
     void flush();
+    void setBufferSize(std::size_t bufferSize);
+    std::size_t bufferSize() const;
+    std::size_t bufferedBytes() const;
+    std::ostream::pos_type position();
+    void patch(std::ostream::pos_type position, const char *buffer, std::size_t length);
+    void patchUInt16BE(std::ostream::pos_type position, uint16 value);
+    void patchUInt32BE(std::ostream::pos_type position, uint32 value);
+    void patchUInt64BE(std::ostream::pos_type position, uint64 value);
+    void patchUInt16LE(std::ostream::pos_type position, uint16 value);
+    void patchUInt32LE(std::ostream::pos_type position, uint32 value);
+    void patchUInt64LE(std::ostream::pos_type position, uint64 value);
     bool fail() const;
     void write(const char *buffer, std::streamsize length);
     void write(const std::vector<char> &buffer, std::streamsize length);
@@ -59,6 +78,22 @@ public:
     void writeUInt64LE(uint64 value);
     void writeFloat32LE(float32 value);
     void writeFloat64LE(float64 value);
+    void writeInt16BE(const int16 *values, std::size_t count);
+    void writeUInt16BE(const uint16 *values, std::size_t count);
+    void writeInt32BE(const int32 *values, std::size_t count);
+    void writeUInt32BE(const uint32 *values, std::size_t count);
+    void writeInt64BE(const int64 *values, std::size_t count);
+    void writeUInt64BE(const uint64 *values, std::size_t count);
+    void writeFloat32BE(const float32 *values, std::size_t count);
+    void writeFloat64BE(const float64 *values, std::size_t count);
+    void writeInt16LE(const int16 *values, std::size_t count);
+    void writeUInt16LE(const uint16 *values, std::size_t count);
+    void writeInt32LE(const int32 *values, std::size_t count);
+    void writeUInt32LE(const uint32 *values, std::size_t count);
+    void writeInt64LE(const int64 *values, std::size_t count);
+    void writeUInt64LE(const uint64 *values, std::size_t count);
+    void writeFloat32LE(const float32 *values, std::size_t count);
+    void writeFloat64LE(const float64 *values, std::size_t count);
     void writeString(const std::string &value);
     void writeTerminatedString(const std::string &value);
     void writeLengthPrefixedString(const std::string &value);
@@ -69,11 +104,28 @@ public:
     void writeSynchsafeUInt32LE(uint32 valueToConvertAndWrite);
     void writeFixed8LE(float32 valueToConvertAndWrite);
     void writeFixed16LE(float32 valueToConvertAndWrite);
+    void writeULeb128(uint64 value);
+    void writeSLeb128(int64 value);
+    void writeZigZagLeb128(int64 value);
+    void writeVInt(uint64 value, std::size_t length = 0);
+    void writeULeb128(const uint64 *values, std::size_t count);
+    template<typename Record, typename Tuple> void writeRecord(const Tuple &values);
 
 private:
+    void writeArray(const uint16 *values, std::size_t count, bool swapOrder);
+    void writeArray(const uint32 *values, std::size_t count, bool swapOrder);
+    void writeArray(const uint64 *values, std::size_t count, bool swapOrder);
+    void writeBuffered(const char *buffer, std::size_t length);
+    void writeBufferedData();
+
     std::ostream *m_stream;
     bool m_ownership;
     char m_buffer[8];
+    std::unique_ptr<char[]> m_outputBuffer;
+    std::size_t m_outputBufferSize;
+    std::size_t m_outputBufferPos;
+    std::streamoff m_outputBufferOffset;
+    Checksum *m_checksum;
 };
 
 /*!
@@ -135,13 +187,121 @@ inline void BinaryWriter::detatchOwnership()
 }
 
 /*!
- * \brief Calls the flush() method of the assigned stream.
+ * \brief Writes all buffered data to the assigned stream and calls the flush() method of the stream.
+ * \sa setBufferSize()
  */
 inline void BinaryWriter::flush()
 {
+    writeBufferedData();
     m_stream->flush();
 }
 
+/*!
+ * \brief Returns the size of the internal write-combining buffer or zero if writes are not buffered.
+ * \sa setBufferSize()
+ */
+inline std::size_t BinaryWriter::bufferSize() const
+{
+    return m_outputBufferSize;
+}
+
+/*!
+ * \brief Returns the number of bytes which have been written to the internal buffer but not to the stream yet.
+ */
+inline std::size_t BinaryWriter::bufferedBytes() const
+{
+    return m_outputBufferPos;
+}
+
+/*!
+ * \brief Overwrites the 16-bit big endian value previously written at the specified \a position.
+ * \sa patch()
+ */
+inline void BinaryWriter::patchUInt16BE(std::ostream::pos_type position, uint16 value)
+{
+    char buffer[sizeof(uint16)];
+    ConversionUtilities::BE::getBytes(value, buffer);
+    patch(position, buffer, sizeof(buffer));
+}
+
+/*!
+ * \brief Overwrites the 32-bit big endian value previously written at the specified \a position.
+ * \sa patch()
+ */
+inline void BinaryWriter::patchUInt32BE(std::ostream::pos_type position, uint32 value)
+{
+    char buffer[sizeof(uint32)];
+    ConversionUtilities::BE::getBytes(value, buffer);
+    patch(position, buffer, sizeof(buffer));
+}
+
+/*!
+ * \brief Overwrites the 64-bit big endian value previously written at the specified \a position.
+ * \sa patch()
+ */
+inline void BinaryWriter::patchUInt64BE(std::ostream::pos_type position, uint64 value)
+{
+    char buffer[sizeof(uint64)];
+    ConversionUtilities::BE::getBytes(value, buffer);
+    patch(position, buffer, sizeof(buffer));
+}
+
+/*!
+ * \brief Overwrites the 16-bit little endian value previously written at the specified \a position.
+ * \sa patch()
+ */
+inline void BinaryWriter::patchUInt16LE(std::ostream::pos_type position, uint16 value)
+{
+    char buffer[sizeof(uint16)];
+    ConversionUtilities::LE::getBytes(value, buffer);
+    patch(position, buffer, sizeof(buffer));
+}
+
+/*!
+ * \brief Overwrites the 32-bit little endian value previously written at the specified \a position.
+ * \sa patch()
+ */
+inline void BinaryWriter::patchUInt32LE(std::ostream::pos_type position, uint32 value)
+{
+    char buffer[sizeof(uint32)];
+    ConversionUtilities::LE::getBytes(value, buffer);
+    patch(position, buffer, sizeof(buffer));
+}
+
+/*!
+ * \brief Overwrites the 64-bit little endian value previously written at the specified \a position.
+ * \sa patch()
+ */
+inline void BinaryWriter::patchUInt64LE(std::ostream::pos_type position, uint64 value)
+{
+    char buffer[sizeof(uint64)];
+    ConversionUtilities::LE::getBytes(value, buffer);
+    patch(position, buffer, sizeof(buffer));
+}
+
+/*!
+ * \brief Returns the checksum which is updated with all data written (if any).
+ * \sa setChecksum()
+ */
+inline Checksum *BinaryWriter::checksum() const
+{
+    return m_checksum;
+}
+
+/*!
+ * \brief Assigns a \a checksum which is updated with all data written until another checksum (or nullptr) is assigned.
+ *
+ * This allows computing the checksum of a region while writing its contents (see Checksum for an example).
+ *
+ * \remarks
+ *  - Does not take ownership over the specified \a checksum.
+ *  - Data overwritten using patch() is not taken into account (the checksum reflects the data originally written).
+ */
+inline void BinaryWriter::setChecksum(Checksum *checksum)
+{
+    m_checksum = checksum;
+}
+
 /*!
  * \brief Returns an indication whether the fail bit of the assigned stream is set.
  */
@@ -152,10 +312,23 @@ inline bool BinaryWriter::fail() const
 
 /*!
  * \brief Writes a character array to the current stream and advances the current position of the stream by the \a length of the array.
+ * \remarks
+ *  - If buffering is enabled the data is only copied to the internal buffer as long as it fits.
+ *  - All write-methods write via this method so the assigned checksum (if any) is updated here.
  */
 inline void BinaryWriter::write(const char *buffer, std::streamsize length)
 {
-    m_stream->write(buffer, length);
+    if(m_checksum) {
+        m_checksum->update(buffer, static_cast<std::size_t>(length));
+    }
+    if(!m_outputBuffer) {
+        m_stream->write(buffer, length);
+    } else if(static_cast<std::size_t>(length) <= m_outputBufferSize - m_outputBufferPos) {
+        std::memcpy(m_outputBuffer.get() + m_outputBufferPos, buffer, static_cast<std::size_t>(length));
+        m_outputBufferPos += static_cast<std::size_t>(length);
+    } else {
+        writeBuffered(buffer, static_cast<std::size_t>(length));
+    }
 }
 
 /*!
@@ -164,7 +337,7 @@ inline void BinaryWriter::write(const char *buffer, std::streamsize length)
  */
 inline void BinaryWriter::write(const std::vector<char> &buffer, std::streamsize length)
 {
-    m_stream->write(buffer.data(), length);
+    write(buffer.data(), length);
 }
 
 /*!
@@ -173,7 +346,7 @@ inline void BinaryWriter::write(const std::vector<char> &buffer, std::streamsize
 inline void BinaryWriter::writeChar(char value)
 {
     m_buffer[0] = value;
-    m_stream->write(m_buffer, 1);
+    write(m_buffer, 1);
 }
 
 /*!
@@ -182,7 +355,7 @@ inline void BinaryWriter::writeChar(char value)
 inline void BinaryWriter::writeByte(byte value)
 {
     m_buffer[0] = *reinterpret_cast<char *>(&value);
-    m_stream->write(m_buffer, 1);
+    write(m_buffer, 1);
 }
 
 /*!
@@ -199,7 +372,7 @@ inline void BinaryWriter::writeBool(bool value)
 inline void BinaryWriter::writeInt16BE(int16 value)
 {
     ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(int16));
+    write(m_buffer, sizeof(int16));
 }
 
 /*!
@@ -208,7 +381,7 @@ inline void BinaryWriter::writeInt16BE(int16 value)
 inline void BinaryWriter::writeUInt16BE(uint16 value)
 {
     ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(uint16));
+    write(m_buffer, sizeof(uint16));
 }
 
 /*!
@@ -217,8 +390,8 @@ inline void BinaryWriter::writeUInt16BE(uint16 value)
  */
 inline void BinaryWriter::writeInt24BE(int32 value)
 {
-    ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 1, 3);
+    ConversionUtilities::BE::getBytes24(static_cast<uint32>(value), m_buffer);
+    write(m_buffer, 3);
 }
 
 /*!
@@ -227,9 +400,8 @@ inline void BinaryWriter::writeInt24BE(int32 value)
  */
 inline void BinaryWriter::writeUInt24BE(uint32 value)
 {
-    // discard most significant byte
-    ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 1, 3);
+    ConversionUtilities::BE::getBytes24(value, m_buffer);
+    write(m_buffer, 3);
 }
 
 /*!
@@ -238,7 +410,7 @@ inline void BinaryWriter::writeUInt24BE(uint32 value)
 inline void BinaryWriter::writeInt32BE(int32 value)
 {
     ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(int32));
+    write(m_buffer, sizeof(int32));
 }
 
 /*!
@@ -247,7 +419,7 @@ inline void BinaryWriter::writeInt32BE(int32 value)
 inline void BinaryWriter::writeUInt32BE(uint32 value)
 {
     ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(uint32));
+    write(m_buffer, sizeof(uint32));
 }
 
 /*!
@@ -256,8 +428,8 @@ inline void BinaryWriter::writeUInt32BE(uint32 value)
  */
 inline void BinaryWriter::writeInt40BE(int64 value)
 {
-    ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 3, 5);
+    ConversionUtilities::BE::getBytes40(static_cast<uint64>(value), m_buffer);
+    write(m_buffer, 5);
 }
 
 /*!
@@ -266,8 +438,8 @@ inline void BinaryWriter::writeInt40BE(int64 value)
  */
 inline void BinaryWriter::writeUInt40BE(uint64 value)
 {
-    ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 3, 5);
+    ConversionUtilities::BE::getBytes40(value, m_buffer);
+    write(m_buffer, 5);
 }
 
 /*!
@@ -276,8 +448,8 @@ inline void BinaryWriter::writeUInt40BE(uint64 value)
  */
 inline void BinaryWriter::writeInt56BE(int64 value)
 {
-    ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 1, 7);
+    ConversionUtilities::BE::getBytes56(static_cast<uint64>(value), m_buffer);
+    write(m_buffer, 7);
 }
 
 /*!
@@ -286,8 +458,8 @@ inline void BinaryWriter::writeInt56BE(int64 value)
  */
 inline void BinaryWriter::writeUInt56BE(uint64 value)
 {
-    ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer + 1, 7);
+    ConversionUtilities::BE::getBytes56(value, m_buffer);
+    write(m_buffer, 7);
 }
 
 /*!
@@ -296,7 +468,7 @@ inline void BinaryWriter::writeUInt56BE(uint64 value)
 inline void BinaryWriter::writeInt64BE(int64 value)
 {
     ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(int64));
+    write(m_buffer, sizeof(int64));
 }
 
 /*!
@@ -305,7 +477,7 @@ inline void BinaryWriter::writeInt64BE(int64 value)
 inline void BinaryWriter::writeUInt64BE(uint64 value)
 {
     ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(uint64));
+    write(m_buffer, sizeof(uint64));
 }
 
 /*!
@@ -314,7 +486,7 @@ inline void BinaryWriter::writeUInt64BE(uint64 value)
 inline void BinaryWriter::writeFloat32BE(float32 value)
 {
     ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(float32));
+    write(m_buffer, sizeof(float32));
 }
 
 /*!
@@ -323,7 +495,7 @@ inline void BinaryWriter::writeFloat32BE(float32 value)
 inline void BinaryWriter::writeFloat64BE(float64 value)
 {
     ConversionUtilities::BE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(float64));
+    write(m_buffer, sizeof(float64));
 }
 
 /*!
@@ -332,7 +504,7 @@ inline void BinaryWriter::writeFloat64BE(float64 value)
 inline void BinaryWriter::writeInt16LE(int16 value)
 {
     ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(int16));
+    write(m_buffer, sizeof(int16));
 }
 
 /*!
@@ -341,7 +513,7 @@ inline void BinaryWriter::writeInt16LE(int16 value)
 inline void BinaryWriter::writeUInt16LE(uint16 value)
 {
     ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(uint16));
+    write(m_buffer, sizeof(uint16));
 }
 
 /*!
@@ -350,9 +522,8 @@ inline void BinaryWriter::writeUInt16LE(uint16 value)
  */
 inline void BinaryWriter::writeInt24LE(int32 value)
 {
-    // discard most significant byte
-    ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 3);
+    ConversionUtilities::LE::getBytes24(static_cast<uint32>(value), m_buffer);
+    write(m_buffer, 3);
 }
 
 /*!
@@ -361,9 +532,8 @@ inline void BinaryWriter::writeInt24LE(int32 value)
  */
 inline void BinaryWriter::writeUInt24LE(uint32 value)
 {
-    // discard most significant byte
-    ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 3);
+    ConversionUtilities::LE::getBytes24(value, m_buffer);
+    write(m_buffer, 3);
 }
 
 /*!
@@ -372,7 +542,7 @@ inline void BinaryWriter::writeUInt24LE(uint32 value)
 inline void BinaryWriter::writeInt32LE(int32 value)
 {
     ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(int32));
+    write(m_buffer, sizeof(int32));
 }
 
 /*!
@@ -381,7 +551,7 @@ inline void BinaryWriter::writeInt32LE(int32 value)
 inline void BinaryWriter::writeUInt32LE(uint32 value)
 {
     ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(uint32));
+    write(m_buffer, sizeof(uint32));
 }
 
 /*!
@@ -390,8 +560,8 @@ inline void BinaryWriter::writeUInt32LE(uint32 value)
  */
 inline void BinaryWriter::writeInt40LE(int64 value)
 {
-    ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 5);
+    ConversionUtilities::LE::getBytes40(static_cast<uint64>(value), m_buffer);
+    write(m_buffer, 5);
 }
 
 /*!
@@ -400,8 +570,8 @@ inline void BinaryWriter::writeInt40LE(int64 value)
  */
 inline void BinaryWriter::writeUInt40LE(uint64 value)
 {
-    ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 5);
+    ConversionUtilities::LE::getBytes40(value, m_buffer);
+    write(m_buffer, 5);
 }
 
 /*!
@@ -410,8 +580,8 @@ inline void BinaryWriter::writeUInt40LE(uint64 value)
  */
 inline void BinaryWriter::writeInt56LE(int64 value)
 {
-    ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 7);
+    ConversionUtilities::LE::getBytes56(static_cast<uint64>(value), m_buffer);
+    write(m_buffer, 7);
 }
 
 /*!
@@ -420,8 +590,8 @@ inline void BinaryWriter::writeInt56LE(int64 value)
  */
 inline void BinaryWriter::writeUInt56LE(uint64 value)
 {
-    ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, 7);
+    ConversionUtilities::LE::getBytes56(value, m_buffer);
+    write(m_buffer, 7);
 }
 
 /*!
@@ -430,7 +600,7 @@ inline void BinaryWriter::writeUInt56LE(uint64 value)
 inline void BinaryWriter::writeInt64LE(int64 value)
 {
     ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(int64));
+    write(m_buffer, sizeof(int64));
 }
 
 /*!
@@ -439,7 +609,7 @@ inline void BinaryWriter::writeInt64LE(int64 value)
 inline void BinaryWriter::writeUInt64LE(uint64 value)
 {
     ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(uint64));
+    write(m_buffer, sizeof(uint64));
 }
 
 /*!
@@ -448,7 +618,7 @@ inline void BinaryWriter::writeUInt64LE(uint64 value)
 inline void BinaryWriter::writeFloat32LE(float32 value)
 {
     ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(float32));
+    write(m_buffer, sizeof(float32));
 }
 
 /*!
@@ -457,7 +627,151 @@ inline void BinaryWriter::writeFloat32LE(float32 value)
 inline void BinaryWriter::writeFloat64LE(float64 value)
 {
     ConversionUtilities::LE::getBytes(value, m_buffer);
-    m_stream->write(m_buffer, sizeof(float64));
+    write(m_buffer, sizeof(float64));
+}
+
+/*!
+ * \brief Writes the specified \a count 16-bit big endian signed integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeInt16BE(const int16 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint16 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 16-bit big endian unsigned integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeUInt16BE(const uint16 *values, std::size_t count)
+{
+    writeArray(values, count, CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 32-bit big endian signed integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeInt32BE(const int32 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint32 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 32-bit big endian unsigned integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeUInt32BE(const uint32 *values, std::size_t count)
+{
+    writeArray(values, count, CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 64-bit big endian signed integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeInt64BE(const int64 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint64 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 64-bit big endian unsigned integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeUInt64BE(const uint64 *values, std::size_t count)
+{
+    writeArray(values, count, CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 32-bit big endian floating point values to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeFloat32BE(const float32 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint32 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 64-bit big endian floating point values to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeFloat64BE(const float64 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint64 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 16-bit little endian signed integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeInt16LE(const int16 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint16 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 16-bit little endian unsigned integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeUInt16LE(const uint16 *values, std::size_t count)
+{
+    writeArray(values, count, CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 32-bit little endian signed integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeInt32LE(const int32 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint32 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 32-bit little endian unsigned integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeUInt32LE(const uint32 *values, std::size_t count)
+{
+    writeArray(values, count, CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 64-bit little endian signed integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeInt64LE(const int64 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint64 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 64-bit little endian unsigned integers to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeUInt64LE(const uint64 *values, std::size_t count)
+{
+    writeArray(values, count, CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 32-bit little endian floating point values to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeFloat32LE(const float32 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint32 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN);
+}
+
+/*!
+ * \brief Writes the specified \a count 64-bit little endian floating point values to the current stream.
+ * \remarks The values are converted block-wise (using SIMD instructions if supported by the CPU) and each block is written at once.
+ */
+inline void BinaryWriter::writeFloat64LE(const float64 *values, std::size_t count)
+{
+    writeArray(reinterpret_cast<const uint64 *>(values), count, CONVERSION_UTILITIES_IS_BYTE_ORDER_BIG_ENDIAN);
 }
 
 /*!
@@ -465,7 +779,7 @@ inline void BinaryWriter::writeFloat64LE(float64 value)
  */
 inline void BinaryWriter::writeString(const std::string &value)
 {
-    m_stream->write(value.c_str(), value.length());
+    write(value.c_str(), value.length());
 }
 
 /*!
@@ -473,7 +787,7 @@ inline void BinaryWriter::writeString(const std::string &value)
  */
 inline void BinaryWriter::writeTerminatedString(const std::string &value)
 {
-    m_stream->write(value.c_str(), value.length() + 1);
+    write(value.c_str(), value.length() + 1);
 }
 
 /*!
@@ -528,6 +842,66 @@ inline void BinaryWriter::writeFixed16LE(float32 valueToConvertAndWrite)
     writeUInt32LE(ConversionUtilities::toFixed16(valueToConvertAndWrite));
 }
 
+/*!
+ * \brief Writes the specified \a value as unsigned LEB128 and advances the current position of the stream by its length (1 to 10 bytes).
+ * \remarks LEB128 is used by eg. DWARF, WebAssembly and Protocol Buffers (where it is called varint).
+ * \sa ConversionUtilities::encodeULeb128()
+ */
+inline void BinaryWriter::writeULeb128(uint64 value)
+{
+    char buffer[ConversionUtilities::maxLeb128Size];
+    write(buffer, static_cast<std::streamsize>(ConversionUtilities::encodeULeb128(value, buffer)));
+}
+
+/*!
+ * \brief Writes the specified \a value as signed LEB128 and advances the current position of the stream by its length (1 to 10 bytes).
+ * \sa ConversionUtilities::encodeSLeb128()
+ */
+inline void BinaryWriter::writeSLeb128(int64 value)
+{
+    char buffer[ConversionUtilities::maxLeb128Size];
+    write(buffer, static_cast<std::streamsize>(ConversionUtilities::encodeSLeb128(value, buffer)));
+}
+
+/*!
+ * \brief Writes the specified \a value zig-zag encoded as unsigned LEB128 and advances the current position of the stream by its length (1 to 10 bytes).
+ * \remarks This is how Protocol Buffers stores "sint64" fields.
+ * \sa ConversionUtilities::zigZagEncode()
+ */
+inline void BinaryWriter::writeZigZagLeb128(int64 value)
+{
+    writeULeb128(ConversionUtilities::zigZagEncode(value));
+}
+
+/*!
+ * \brief Writes the specified \a value as EBML variable size integer (VINT) and advances the current position of the stream by its length (1 to 8 bytes).
+ * \param value Specifies the value. Passing ConversionUtilities::vIntUnknownSize writes the marker for elements of unknown size.
+ * \param length Specifies the number of bytes to use. Zero means the minimum length is used.
+ * \throws Throws ConversionException if \a value is too big or does not fit into the specified \a length.
+ * \sa ConversionUtilities::encodeVInt()
+ */
+inline void BinaryWriter::writeVInt(uint64 value, std::size_t length)
+{
+    char buffer[ConversionUtilities::maxVIntSize];
+    write(buffer, static_cast<std::streamsize>(ConversionUtilities::encodeVInt(value, buffer, length)));
+}
+
+/*!
+ * \brief Writes a record of the specified type and advances the current position of the stream by the size of the record.
+ *
+ * The fields are encoded into a buffer first which is then written at once.
+ *
+ * \tparam Record Specifies the ConversionUtilities::BinaryRecord to be written.
+ * \param values Specifies a tuple with one element per field, eg. a tuple of references created via std::tie().
+ */
+template<typename Record, typename Tuple>
+void BinaryWriter::writeRecord(const Tuple &values)
+{
+    char buffer[Record::size];
+    Record::encode(values, buffer);
+    write(buffer, static_cast<std::streamsize>(Record::size));
+}
+
 }
 
 #endif // IO_UTILITIES_BINARYWRITER_H
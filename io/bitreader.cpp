@@ -6,27 +6,69 @@ using namespace std;
 namespace IoUtilities {
 
 /*!
- * \class IoUtilities::BitReader
- * \brief The BitReader class provides bitwise reading of buffered data.
+ * \class IoUtilities::BasicBitReader
+ * \brief The BasicBitReader class provides bitwise reading of buffered data.
+ *
+ * The bit order is specified via the template parameter \a order. Usually the typedefs BitReader
+ * (MSB-first) and LsbBitReader (LSB-first) are used.
+ *
+ * Internally up to 63 bits are cached in a 64-bit integer which is refilled word-wise. Hence
+ * reading, peeking and skipping bits usually boils down to a few shifts. Both bit orders share the
+ * same implementation; the order only determines the direction of the shifts and the byte order
+ * of the refill. This is decided at compile-time.
  */
 
+/*!
+ * \brief Reads bits which are not present in the cache even after refilling it.
+ *
+ * This is the case when the end of the buffer has been reached or more than 56 bits are requested.
+ */
+template<BitOrder order>
+uint64 BasicBitReader<order>::readBitsSlowly(byte bitCount)
+{
+    if(bitCount > bitsAvailable()) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    uint64 val = 0;
+    for(byte readAtOnce, bitsRead = 0; bitsRead != bitCount; bitsRead += readAtOnce) {
+        readAtOnce = min<byte>(bitCount - bitsRead, 32);
+        if(order == BitOrder::MsbFirst) {
+            val = (val << readAtOnce) | readBits<uint64>(readAtOnce);
+        } else {
+            val |= readBits<uint64>(readAtOnce) << bitsRead;
+        }
+    }
+    return val;
+}
+
 /*!
  * \brief Skips the specified number of bits without reading it.
  * \param bitCount Specifies the number of bits to skip.
  * \throws Throws std::ios_base::failure if the end of the buffer is exceeded.
- *         The reader becomes invalid in that case.
+ *         The current position is not altered in that case.
  */
-void BitReader::skipBits(std::size_t bitCount)
+template<BitOrder order>
+void BasicBitReader<order>::skipBits(std::size_t bitCount)
 {
-    if(bitCount <= m_bitsAvail) {
-        m_bitsAvail -= bitCount;
-    } else {
-        if((m_buffer += 1 + (bitCount -= m_bitsAvail) / 8) >= m_end) {
-            throwIoFailure("end of buffer exceeded");
-        }
-        m_bitsAvail = 8 - (bitCount % 8);
+    if(bitCount <= m_cacheBits) {
+        dropCachedBits(static_cast<byte>(bitCount));
+        return;
+    }
+    if(bitCount > bitsAvailable()) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    bitCount -= m_cacheBits;
+    m_buffer += bitCount / 8;
+    m_cache = 0;
+    m_cacheBits = 0;
+    if((bitCount %= 8)) {
+        refill();
+        dropCachedBits(static_cast<byte>(bitCount));
     }
 }
 
+template class BasicBitReader<BitOrder::MsbFirst>;
+template class BasicBitReader<BitOrder::LsbFirst>;
+
 } // namespace IoUtilities
 
@@ -2,7 +2,9 @@
 #define IOUTILITIES_BITREADER_H
 
 #include "../conversion/types.h"
+#include "../conversion/binaryconversion.h"
 #include "../io/catchiofailure.h"
+#include "../math/math.h"
 #include "../global.h"
 
 #include <ios>
@@ -11,11 +13,21 @@
 
 namespace IoUtilities {
 
-class CPP_UTILITIES_EXPORT BitReader
+/*!
+ * \brief Specifies the order in which the bits of a byte are read by BasicBitReader.
+ */
+enum class BitOrder
+{
+    MsbFirst, /**< the most significant bit comes first (eg. MPEG, H.264, AAC, FLAC) */
+    LsbFirst /**< the least significant bit comes first (eg. Vorbis, DEFLATE) */
+};
+
+template<BitOrder order>
+class BasicBitReader
 {
 public:
-    BitReader(const char *buffer, std::size_t bufferSize);
-    BitReader(const char *buffer, const char *end);
+    BasicBitReader(const char *buffer, std::size_t bufferSize);
+    BasicBitReader(const char *buffer, const char *end);
 
     template<typename intType> intType readBits(byte bitCount);
     byte readBit();
@@ -29,64 +41,146 @@ public:
     void reset(const char *buffer, const char *end);
 
 private:
+    void refill();
+    uint64 peekCachedBits(byte bitCount) const;
+    void dropCachedBits(byte bitCount);
+    uint64 readBitsSlowly(byte bitCount);
+
     const byte *m_buffer;
     const byte *m_end;
-    byte m_bitsAvail;
+    uint64 m_cache;
+    byte m_cacheBits;
 };
 
 /*!
- * \brief Constructs a new BitReader.
+ * \brief Reads bits MSB-first.
+ */
+typedef BasicBitReader<BitOrder::MsbFirst> BitReader;
+
+/*!
+ * \brief Reads bits LSB-first.
+ */
+typedef BasicBitReader<BitOrder::LsbFirst> LsbBitReader;
+
+/*!
+ * \brief Constructs a new BasicBitReader.
  * \remarks
  *  - Does not take ownership over the specified \a buffer.
  *  - bufferSize must be equal or greather than 1.
  */
-inline BitReader::BitReader(const char *buffer, std::size_t bufferSize) :
-    BitReader(buffer, buffer + bufferSize)
+template<BitOrder order>
+inline BasicBitReader<order>::BasicBitReader(const char *buffer, std::size_t bufferSize) :
+    BasicBitReader(buffer, buffer + bufferSize)
 {}
 
 /*!
- * \brief Constructs a new BitReader.
+ * \brief Constructs a new BasicBitReader.
  * \remarks
  *  - Does not take ownership over the specified \a buffer.
  *  - \a end must be greather than \a buffer.
  */
-inline BitReader::BitReader(const char *buffer, const char *end) :
+template<BitOrder order>
+inline BasicBitReader<order>::BasicBitReader(const char *buffer, const char *end) :
     m_buffer(reinterpret_cast<const byte *>(buffer)),
     m_end(reinterpret_cast<const byte *>(end)),
-    m_bitsAvail(8)
+    m_cache(0),
+    m_cacheBits(0)
 {}
 
+/*!
+ * \brief Moves as many whole bytes from the buffer into the cache as possible.
+ *
+ * For MSB-first reading the most significant bit of the cache is always the next bit to be read and for
+ * LSB-first reading the least significant bit. If at least 8 bytes are left, the bytes are taken from a
+ * single unaligned load (big endian respectively little endian). Otherwise they are taken one by one.
+ * Afterwards the cache holds at least 56 bits unless the end of the buffer has been reached. It never
+ * holds more than 63 bits so shifting it by the number of cached bits is always defined.
+ *
+ * \remarks
+ *  - The bits after the cached bits are either zero or equal to the next bits of the buffer. Hence
+ *    or-ing the next bytes into the cache is fine.
+ *  - The conditions on \a order are compile-time constants so no branches remain.
+ */
+template<BitOrder order>
+inline void BasicBitReader<order>::refill()
+{
+    if(m_end - m_buffer >= 8) {
+        if(order == BitOrder::MsbFirst) {
+            m_cache |= ConversionUtilities::BE::toUInt64(reinterpret_cast<const char *>(m_buffer)) >> m_cacheBits;
+        } else {
+            m_cache |= ConversionUtilities::LE::toUInt64(reinterpret_cast<const char *>(m_buffer)) << m_cacheBits;
+        }
+        const byte bytesTaken = (63 - m_cacheBits) >> 3;
+        m_buffer += bytesTaken;
+        m_cacheBits += bytesTaken << 3;
+    } else {
+        for(; m_cacheBits <= 55 && m_buffer != m_end; m_cacheBits += 8) {
+            m_cache |= static_cast<uint64>(*m_buffer++) << (order == BitOrder::MsbFirst ? (56 - m_cacheBits) : m_cacheBits);
+        }
+    }
+}
+
+/*!
+ * \brief Returns the next \a bitCount bits from the cache.
+ * \remarks \a bitCount must not exceed the number of cached bits.
+ */
+template<BitOrder order>
+inline uint64 BasicBitReader<order>::peekCachedBits(byte bitCount) const
+{
+    if(order == BitOrder::MsbFirst) {
+        return bitCount ? (m_cache >> (64 - bitCount)) : 0;
+    } else {
+        return m_cache & ((static_cast<uint64>(1) << bitCount) - 1);
+    }
+}
+
+/*!
+ * \brief Removes the next \a bitCount bits from the cache.
+ * \remarks \a bitCount must not exceed the number of cached bits.
+ */
+template<BitOrder order>
+inline void BasicBitReader<order>::dropCachedBits(byte bitCount)
+{
+    if(order == BitOrder::MsbFirst) {
+        m_cache <<= bitCount;
+    } else {
+        m_cache >>= bitCount;
+    }
+    m_cacheBits -= bitCount;
+}
+
 /*!
  * \brief Reads the specified number of bits from the buffer advancing the current position by \a bitCount bits.
  * \param bitCount Specifies the number of bits read.
  * \tparam intType Specifies the type of the returned value.
- * \remarks Does not check whether intType is big enough to hold result.
+ * \remarks
+ *  - Does not check whether intType is big enough to hold result.
+ *  - Reading up to 56 bits at once requires only one refill of the internal cache.
+ *  - When reading LSB-first the first bit read becomes the least significant bit of the returned value.
  * \throws Throws ios_base::failure if the end of the buffer is exceeded.
- *         The reader becomes invalid in that case.
+ *         The current position is not altered in that case.
  */
+template<BitOrder order>
 template<typename intType>
-intType BitReader::readBits(byte bitCount)
+intType BasicBitReader<order>::readBits(byte bitCount)
 {
-    intType val = 0;
-    for(byte readAtOnce; bitCount; bitCount -= readAtOnce) {
-        if(!m_bitsAvail) {
-            if(++m_buffer >= m_end) {
-                throwIoFailure("end of buffer exceeded");
-            }
-            m_bitsAvail = 8;
+    if(bitCount > m_cacheBits) {
+        refill();
+        if(bitCount > m_cacheBits) {
+            return static_cast<intType>(readBitsSlowly(bitCount));
         }
-        readAtOnce = std::min(bitCount, m_bitsAvail);
-        val = (val << readAtOnce) | (((*m_buffer) >> (m_bitsAvail -= readAtOnce)) & (0xFF >> (0x08 - readAtOnce)));
     }
-    return val;
+    const uint64 val = peekCachedBits(bitCount);
+    dropCachedBits(bitCount);
+    return static_cast<intType>(val);
 }
 
 /*!
  * \brief Reads the one bit from the buffer advancing the current position by one bit.
  * \throws Throws ios_base::failure if the end of the buffer is exceeded.
- *         The reader becomes invalid in that case.
  */
-inline byte BitReader::readBit()
+template<BitOrder order>
+inline byte BasicBitReader<order>::readBit()
 {
     return readBits<byte>(1) == 1;
 }
@@ -94,31 +188,45 @@ inline byte BitReader::readBit()
 /*!
  * \brief Reads "Exp-Golomb coded" bits (unsigned).
  * \tparam intType Specifies the type of the returned value.
- * \remarks Does not check whether intType is big enough to hold result.
+ * \remarks
+ *  - Does not check whether intType is big enough to hold result.
+ *  - The leading zeros are counted within the internal cache at once (falls back to
+ *    reading them bit by bit if the prefix is longer than the cache).
+ *  - Only available when reading MSB-first.
  * \throws Throws ios_base::failure if the end of the buffer is exceeded.
  *         The reader becomes invalid in that case.
  * \sa https://en.wikipedia.org/wiki/Exponential-Golomb_coding
  */
+template<BitOrder order>
 template<typename intType>
-intType BitReader::readUnsignedExpGolombCodedBits()
+intType BasicBitReader<order>::readUnsignedExpGolombCodedBits()
 {
-    byte count = 0;
-    while(!readBit()) {
-        ++count;
+    static_assert(order == BitOrder::MsbFirst, "Exp-Golomb codes are only supported when reading MSB-first");
+    if(m_cacheBits < 32) {
+        refill();
+    }
+    byte count = MathUtilities::countLeadingZeros(m_cache);
+    if(count < m_cacheBits) {
+        dropCachedBits(count + 1);
+    } else {
+        for(count = 0; !readBit(); ++count);
     }
-    return count ? (((1 << count) | readBits<intType>(count)) - 1) : 0;
+    return count ? (((static_cast<intType>(1) << count) | readBits<intType>(count)) - 1) : 0;
 }
 
 /*!
  * \brief Reads "Exp-Golomb coded" bits (signed).
  * \tparam intType Specifies the type of the returned value which should be signed (obviously).
- * \remarks Does not check whether intType is big enough to hold result.
+ * \remarks
+ *  - Does not check whether intType is big enough to hold result.
+ *  - Only available when reading MSB-first.
  * \throws Throws ios_base::failure if the end of the buffer is exceeded.
  *         The reader becomes invalid in that case.
  * \sa https://en.wikipedia.org/wiki/Exponential-Golomb_coding
  */
+template<BitOrder order>
 template<typename intType>
-intType BitReader::readSignedExpGolombCodedBits()
+intType BasicBitReader<order>::readSignedExpGolombCodedBits()
 {
     auto value = readUnsignedExpGolombCodedBits<typename std::make_unsigned<intType>::type>();
     return (value % 2) ? static_cast<intType>((value + 1) / 2) : (-static_cast<intType>(value / 2));
@@ -127,19 +235,27 @@ intType BitReader::readSignedExpGolombCodedBits()
 /*!
  * \brief Reads the specified number of bits from the buffer without advancing the current position.
  */
+template<BitOrder order>
 template<typename intType>
-intType BitReader::showBits(byte bitCount)
+intType BasicBitReader<order>::showBits(byte bitCount)
 {
-    auto tmp = *this;
-    return tmp.readBits<intType>(bitCount);
+    if(bitCount > m_cacheBits) {
+        refill();
+        if(bitCount > m_cacheBits) {
+            auto tmp = *this;
+            return tmp.template readBits<intType>(bitCount);
+        }
+    }
+    return static_cast<intType>(peekCachedBits(bitCount));
 }
 
 /*!
  * \brief Returns the number of bits which are still available to read.
  */
-inline std::size_t BitReader::bitsAvailable()
+template<BitOrder order>
+inline std::size_t BasicBitReader<order>::bitsAvailable()
 {
-    return ((m_end - m_buffer) * 8) + m_bitsAvail;
+    return static_cast<std::size_t>(m_end - m_buffer) * 8 + m_cacheBits;
 }
 
 /*!
@@ -148,11 +264,10 @@ inline std::size_t BitReader::bitsAvailable()
  *  - Does not take ownership over the specified \a buffer.
  *  - bufferSize must be equal or greather than 1.
  */
-inline void BitReader::reset(const char *buffer, std::size_t bufferSize)
+template<BitOrder order>
+inline void BasicBitReader<order>::reset(const char *buffer, std::size_t bufferSize)
 {
-    m_buffer = reinterpret_cast<const byte *>(buffer);
-    m_end = reinterpret_cast<const byte *>(buffer + bufferSize);
-    m_bitsAvail = 8;
+    reset(buffer, buffer + bufferSize);
 }
 
 /*!
@@ -161,21 +276,31 @@ inline void BitReader::reset(const char *buffer, std::size_t bufferSize)
  *  - Does not take ownership over the specified \a buffer.
  *  - \a end must be greather than \a buffer.
  */
-inline void BitReader::reset(const char *buffer, const char *end)
+template<BitOrder order>
+inline void BasicBitReader<order>::reset(const char *buffer, const char *end)
 {
     m_buffer = reinterpret_cast<const byte *>(buffer);
     m_end = reinterpret_cast<const byte *>(end);
-    m_bitsAvail = 8;
+    m_cache = 0;
+    m_cacheBits = 0;
 }
 
 /*!
  * \brief Re-establishes alignment.
+ * \remarks Skips the remaining bits of the current byte. Does nothing if the current position is already aligned.
  */
-inline void BitReader::align()
+template<BitOrder order>
+inline void BasicBitReader<order>::align()
 {
-    skipBits(m_bitsAvail);
+    // the buffer is always consumed byte-wise so the number of cached bits determines the offset within the current byte
+    skipBits(m_cacheBits & 7);
 }
 
+/// \cond
+extern template class CPP_UTILITIES_EXPORT BasicBitReader<BitOrder::MsbFirst>;
+extern template class CPP_UTILITIES_EXPORT BasicBitReader<BitOrder::LsbFirst>;
+/// \endcond
+
 } // namespace IoUtilities
 
 #endif // IOUTILITIES_BITREADER_H
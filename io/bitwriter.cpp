@@ -0,0 +1,124 @@
+#include "./bitwriter.h"
+#include "./catchiofailure.h"
+
+#include "../conversion/binaryconversion.h"
+
+#include <cstring>
+
+using namespace std;
+using namespace ConversionUtilities;
+
+namespace IoUtilities {
+
+/*!
+ * \class IoUtilities::BitWriter
+ * \brief The BitWriter class provides bitwise writing of data (MSB-first).
+ *
+ * The written bits are collected in a 64-bit accumulator. Only whole words are written to the buffer
+ * until flush() is called. The buffer is either provided by the caller (fixed size) or a std::vector
+ * which is grown as needed:
+ * \code
+ * std::vector<char> header;
+ * BitWriter writer(header);
+ * writer.writeBits(0xFFF, 12); // syncword
+ * writer.writeUnsignedExpGolombCodedBits(5u);
+ * writer.flush(); // header contains the written bits now
+ * \endcode
+ *
+ * The written data can be read using BitReader.
+ */
+
+/*!
+ * \brief Destroys the writer flushing the remaining bits.
+ * \remarks Errors are ignored. Call flush() explicitly to handle them.
+ */
+BitWriter::~BitWriter()
+{
+    try {
+        flush();
+    } catch(...) {
+    }
+}
+
+/*!
+ * \brief Pads the written bits to the next byte boundary and writes them to the buffer.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ */
+void BitWriter::flush()
+{
+    align();
+    if(const byte byteCount = (64 - m_freeBits) / 8) {
+        char bytes[8];
+        BE::getBytes(m_cache << m_freeBits, bytes);
+        writeBytes(bytes, byteCount);
+    }
+    m_cache = 0;
+    m_freeBits = 64;
+}
+
+/*!
+ * \brief Resets the writer to write to the specified \a buffer.
+ * \remarks
+ *  - Bits which have not been flushed yet are discarded.
+ *  - Does not take ownership over the specified \a buffer.
+ */
+void BitWriter::reset(char *buffer, size_t bufferSize)
+{
+    reset(buffer, buffer + bufferSize);
+}
+
+/*!
+ * \brief Resets the writer to write to the specified \a buffer.
+ * \remarks
+ *  - Bits which have not been flushed yet are discarded.
+ *  - Does not take ownership over the specified \a buffer.
+ */
+void BitWriter::reset(char *buffer, char *end)
+{
+    m_buffer = buffer;
+    m_end = end;
+    m_vector = nullptr;
+    m_bytesWritten = 0;
+    m_cache = 0;
+    m_freeBits = 64;
+}
+
+/*!
+ * \brief Resets the writer to append to the specified \a buffer.
+ * \remarks Bits which have not been flushed yet are discarded.
+ */
+void BitWriter::reset(std::vector<char> &buffer)
+{
+    reset(nullptr, nullptr);
+    m_vector = &buffer;
+}
+
+/*!
+ * \brief Writes the full accumulator to the buffer.
+ */
+void BitWriter::writeWord()
+{
+    char bytes[8];
+    BE::getBytes(m_cache, bytes);
+    writeBytes(bytes, sizeof(bytes));
+}
+
+/*!
+ * \brief Writes the specified \a bytes to the buffer.
+ * \throws Throws ios_base::failure if the end of a fixed size buffer is exceeded.
+ */
+void BitWriter::writeBytes(const char *bytes, size_t count)
+{
+    if(m_vector) {
+        m_vector->insert(m_vector->end(), bytes, bytes + count);
+    } else {
+        if(static_cast<size_t>(m_end - m_buffer) < count) {
+            throwIoFailure("end of buffer exceeded");
+        }
+        memcpy(m_buffer, bytes, count);
+        m_buffer += count;
+    }
+    m_bytesWritten += count;
+}
+
+} // namespace IoUtilities
@@ -0,0 +1,172 @@
+#ifndef IOUTILITIES_BITWRITER_H
+#define IOUTILITIES_BITWRITER_H
+
+#include "../conversion/types.h"
+#include "../math/math.h"
+#include "../global.h"
+
+#include <vector>
+
+namespace IoUtilities {
+
+class CPP_UTILITIES_EXPORT BitWriter
+{
+public:
+    BitWriter(char *buffer, std::size_t bufferSize);
+    BitWriter(char *buffer, char *end);
+    BitWriter(std::vector<char> &buffer);
+    BitWriter(const BitWriter &other) = delete;
+    ~BitWriter();
+    BitWriter &operator=(const BitWriter &other) = delete;
+
+    template<typename intType> void writeBits(intType value, byte bitCount);
+    void writeBit(bool value);
+    template<typename intType> void writeUnsignedExpGolombCodedBits(intType value);
+    template<typename intType> void writeSignedExpGolombCodedBits(intType value);
+    void align();
+    void flush();
+    std::size_t bitsWritten() const;
+    void reset(char *buffer, std::size_t bufferSize);
+    void reset(char *buffer, char *end);
+    void reset(std::vector<char> &buffer);
+
+private:
+    void writeWord();
+    void writeBytes(const char *bytes, std::size_t count);
+
+    char *m_buffer;
+    char *m_end;
+    std::vector<char> *m_vector;
+    std::size_t m_bytesWritten;
+    uint64 m_cache;
+    byte m_freeBits;
+};
+
+/*!
+ * \brief Constructs a new BitWriter writing to the specified \a buffer.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+inline BitWriter::BitWriter(char *buffer, std::size_t bufferSize) :
+    BitWriter(buffer, buffer + bufferSize)
+{}
+
+/*!
+ * \brief Constructs a new BitWriter writing to the specified \a buffer.
+ * \remarks
+ *  - Does not take ownership over the specified \a buffer.
+ *  - \a end must be equal or greather than \a buffer.
+ */
+inline BitWriter::BitWriter(char *buffer, char *end) :
+    m_buffer(buffer),
+    m_end(end),
+    m_vector(nullptr),
+    m_bytesWritten(0),
+    m_cache(0),
+    m_freeBits(64)
+{}
+
+/*!
+ * \brief Constructs a new BitWriter appending to the specified \a buffer.
+ * \remarks The \a buffer is grown as needed. It must not be destroyed before the BitWriter.
+ */
+inline BitWriter::BitWriter(std::vector<char> &buffer) :
+    m_buffer(nullptr),
+    m_end(nullptr),
+    m_vector(&buffer),
+    m_bytesWritten(0),
+    m_cache(0),
+    m_freeBits(64)
+{}
+
+/*!
+ * \brief Writes the \a bitCount least significant bits of the specified \a value (MSB-first).
+ * \param value Specifies the value to be written. Higher bits are ignored.
+ * \param bitCount Specifies the number of bits to be written (at most 64).
+ * \remarks The bits are collected in a 64-bit accumulator which is written to the buffer when it is full.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ *         The writer becomes invalid in that case.
+ */
+template<typename intType>
+void BitWriter::writeBits(intType value, byte bitCount)
+{
+    uint64 bits = static_cast<uint64>(value);
+    if(bitCount < 64) {
+        bits &= (static_cast<uint64>(1) << bitCount) - 1;
+    }
+    if(bitCount < m_freeBits) {
+        m_cache = (m_cache << bitCount) | bits;
+        m_freeBits -= bitCount;
+    } else {
+        // fill the accumulator, write it and keep the remaining bits
+        // (the already written bits stay above the remaining bits but are shifted out before being written again)
+        const byte remainingBits = bitCount - m_freeBits;
+        m_cache = m_freeBits < 64 ? ((m_cache << m_freeBits) | (bits >> remainingBits)) : bits;
+        writeWord();
+        m_cache = bits;
+        m_freeBits = 64 - remainingBits;
+    }
+}
+
+/*!
+ * \brief Writes a single bit.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ */
+inline void BitWriter::writeBit(bool value)
+{
+    writeBits<byte>(value ? 1 : 0, 1);
+}
+
+/*!
+ * \brief Writes the specified \a value "Exp-Golomb coded" (unsigned).
+ * \remarks The greatest 64-bit unsigned integer can not be encoded.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ * \sa https://en.wikipedia.org/wiki/Exponential-Golomb_coding
+ */
+template<typename intType>
+void BitWriter::writeUnsignedExpGolombCodedBits(intType value)
+{
+    const uint64 codeNum = static_cast<uint64>(value) + 1;
+    const byte bitLength = 64 - MathUtilities::countLeadingZeros(codeNum);
+    if(bitLength <= 32) {
+        // the leading zeros are implied by writing the value with twice its length
+        writeBits(codeNum, static_cast<byte>(2 * bitLength - 1));
+    } else {
+        writeBits<byte>(0, static_cast<byte>(bitLength - 1));
+        writeBits(codeNum, bitLength);
+    }
+}
+
+/*!
+ * \brief Writes the specified \a value "Exp-Golomb coded" (signed).
+ * \remarks The smallest 64-bit signed integer can not be encoded.
+ * \throws Throws ios_base::failure if the end of the buffer is exceeded.
+ * \sa https://en.wikipedia.org/wiki/Exponential-Golomb_coding
+ */
+template<typename intType>
+void BitWriter::writeSignedExpGolombCodedBits(intType value)
+{
+    writeUnsignedExpGolombCodedBits<uint64>(value > 0
+                                            ? static_cast<uint64>(value) * 2 - 1
+                                            : static_cast<uint64>(-static_cast<int64>(value)) * 2);
+}
+
+/*!
+ * \brief Writes zero bits until the current position is aligned to a byte boundary.
+ * \remarks Does nothing if the current position is already aligned.
+ */
+inline void BitWriter::align()
+{
+    writeBits<byte>(0, m_freeBits & 7);
+}
+
+/*!
+ * \brief Returns the number of bits written so far (including the bits which have not been flushed yet).
+ */
+inline std::size_t BitWriter::bitsWritten() const
+{
+    return m_bytesWritten * 8 + (64 - m_freeBits);
+}
+
+} // namespace IoUtilities
+
+#endif // IOUTILITIES_BITWRITER_H
@@ -0,0 +1,313 @@
+#include "./bufferreader.h"
+#include "./binaryreader.h"
+
+#include "../conversion/conversionexception.h"
+
+using namespace std;
+using namespace ConversionUtilities;
+
+namespace IoUtilities {
+
+/*!
+ * \class IoUtilities::BufferReader
+ * \brief Reads primitive data types from a contiguous block of memory.
+ *
+ * The BufferReader provides the same read-methods as BinaryReader. Instead of going through
+ * a std::istream it decodes the values directly from the specified buffer so reading a value
+ * boils down to a bounds check and a load. This makes it the preferable choice for parsing
+ * data which is already present in memory.
+ *
+ * \remarks
+ *  - Supports both, little endian and big endian.
+ *  - Does not take ownership over the buffer.
+ *  - Throws std::ios_base::failure if the end of the buffer is exceeded.
+ * \sa IoUtilities::BinaryReader
+ */
+
+/*!
+ * \brief Reads a length prefixed string.
+ *
+ * \remarks Reads the length prefix and then a string of the denoted length.
+ *          Advances the current position by the denoted length of the string plus the prefix length.
+ * \sa BinaryReader::readLengthPrefixedString()
+ */
+string BufferReader::readLengthPrefixedString()
+{
+    return readString(readLengthPrefix());
+}
+
+/*!
+ * \brief Reads a length prefixed string into \a result.
+ * \remarks The capacity of \a result is reused. Advances the current position like readLengthPrefixedString().
+ */
+void BufferReader::readLengthPrefixedString(string &result)
+{
+    readString(result, readLengthPrefix());
+}
+
+/*!
+ * \brief Skips a length prefixed string.
+ *
+ * Advances the current position like readLengthPrefixedString() without copying the string.
+ */
+void BufferReader::skipLengthPrefixedString()
+{
+    skip(readLengthPrefix());
+}
+
+/// \cond
+
+/*!
+ * \brief Reads the length prefix of a length prefixed string.
+ */
+uint32 BufferReader::readLengthPrefix()
+{
+    static const int maxPrefixLength = 4;
+    if(!canRead()) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    int prefixLength = 1;
+    const byte beg = static_cast<byte>(*m_pos);
+    byte mask = 0x80;
+    while(prefixLength <= maxPrefixLength && (beg & mask) == 0) {
+        ++prefixLength;
+        mask >>= 1;
+    }
+    if(prefixLength > maxPrefixLength) {
+        throw ConversionException("Length denotation of length-prefixed string exceeds maximum.");
+    }
+    char buffer[maxPrefixLength] = {0};
+    memcpy(buffer + (maxPrefixLength - prefixLength), consume(prefixLength), prefixLength);
+    *(buffer + (maxPrefixLength - prefixLength)) ^= mask;
+    return BE::toUInt32(buffer);
+}
+
+/// \endcond
+
+/*!
+ * \brief Reads a terminated string.
+ *
+ * Advances the current position by the string length plus one byte.
+ *
+ * \param termination The byte to be recognized as termination value.
+ * \throws Throws std::ios_base::failure if the end of the buffer is reached before the termination value.
+ */
+string BufferReader::readTerminatedString(byte termination)
+{
+    const StringView view = readTerminatedStringView(termination);
+    return string(view.first, view.second);
+}
+
+/*!
+ * \brief Reads a terminated string.
+ *
+ * Advances the current position by the string length plus one byte but maximal by \a maxBytesToRead.
+ *
+ * \param maxBytesToRead The maximal number of bytes to read.
+ * \param termination The value to be recognized as termination.
+ */
+string BufferReader::readTerminatedString(size_t maxBytesToRead, byte termination)
+{
+    const StringView view = readTerminatedStringView(maxBytesToRead, termination);
+    return string(view.first, view.second);
+}
+
+/*!
+ * \brief Reads a terminated string into \a result.
+ * \remarks The capacity of \a result is reused. Advances the current position like readTerminatedString(byte).
+ * \throws Throws std::ios_base::failure if the end of the buffer is reached before the termination value.
+ */
+void BufferReader::readTerminatedString(string &result, byte termination)
+{
+    const StringView view = readTerminatedStringView(termination);
+    result.assign(view.first, view.second);
+}
+
+/*!
+ * \brief Reads a terminated string into \a result.
+ * \remarks The capacity of \a result is reused. Advances the current position like readTerminatedString(size_t, byte).
+ */
+void BufferReader::readTerminatedString(string &result, size_t maxBytesToRead, byte termination)
+{
+    const StringView view = readTerminatedStringView(maxBytesToRead, termination);
+    result.assign(view.first, view.second);
+}
+
+/*!
+ * \brief Reads a terminated string.
+ *
+ * Advances the current position by the string length plus one byte.
+ *
+ * \param termination The byte to be recognized as termination value.
+ * \returns Returns a view into the buffer (excluding the termination). Nothing is allocated or copied.
+ * \throws Throws std::ios_base::failure if the end of the buffer is reached before the termination value.
+ */
+StringView BufferReader::readTerminatedStringView(byte termination)
+{
+    const auto *const delim = reinterpret_cast<const char *>(memchr(m_pos, termination, bytesAvailable()));
+    if(!delim) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    const char *const start = consume(static_cast<size_t>(delim - m_pos) + 1);
+    return StringView(start, static_cast<size_t>(delim - start));
+}
+
+/*!
+ * \brief Reads a terminated string.
+ *
+ * Advances the current position by the string length plus one byte but maximal by \a maxBytesToRead.
+ *
+ * \param maxBytesToRead The maximal number of bytes to read.
+ * \param termination The value to be recognized as termination.
+ * \returns Returns a view into the buffer (excluding the termination). Nothing is allocated or copied.
+ */
+StringView BufferReader::readTerminatedStringView(size_t maxBytesToRead, byte termination)
+{
+    const auto *const delim = reinterpret_cast<const char *>(memchr(m_pos, termination, min(maxBytesToRead, bytesAvailable())));
+    if(!delim) {
+        return readStringView(maxBytesToRead);
+    }
+    const char *const start = consume(static_cast<size_t>(delim - m_pos) + 1);
+    return StringView(start, static_cast<size_t>(delim - start));
+}
+
+/// \cond
+
+/*!
+ * \brief Reads a string terminated by the two bytes specified via \a delimChars.
+ * \remarks Only considers the termination at even offsets (relative to the current position).
+ */
+string BufferReader::readMultibyteTerminatedString(size_t maxBytesToRead, const char *delimChars, bool bounded)
+{
+    const size_t available = bytesAvailable();
+    const size_t scanSize = (bounded ? min(maxBytesToRead, available) : available) & ~static_cast<size_t>(1);
+    for(const char *i = m_pos, *end = m_pos + scanSize; i != end; i += 2) {
+        if(i[0] == delimChars[0] && i[1] == delimChars[1]) {
+            const char *const start = consume(static_cast<size_t>(i - m_pos) + 2);
+            return string(start, i);
+        }
+    }
+    if(!bounded) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    return readString(maxBytesToRead);
+}
+
+/// \endcond
+
+/*!
+ * \brief Reads a multibyte-terminated string.
+ *
+ * Advances the current position by the string length plus two bytes.
+ *
+ * \param termination Specifies the two byte sized big endian value to be recognized as termination.
+ * \throws Throws std::ios_base::failure if the end of the buffer is reached before the termination value.
+ */
+string BufferReader::readMultibyteTerminatedStringBE(uint16 termination)
+{
+    char delimChars[2];
+    BE::getBytes(termination, delimChars);
+    return readMultibyteTerminatedString(0, delimChars, false);
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string.
+ *
+ * Advances the current position by the string length plus two bytes.
+ *
+ * \param termination Specifies the two byte sized little endian value to be recognized as termination.
+ * \throws Throws std::ios_base::failure if the end of the buffer is reached before the termination value.
+ */
+string BufferReader::readMultibyteTerminatedStringLE(uint16 termination)
+{
+    char delimChars[2];
+    LE::getBytes(termination, delimChars);
+    return readMultibyteTerminatedString(0, delimChars, false);
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string.
+ *
+ * Advances the current position by the string length plus two bytes but maximal by \a maxBytesToRead.
+ *
+ * \param maxBytesToRead The maximal number of bytes to read.
+ * \param termination The two byte sized big endian value to be recognized as termination.
+ */
+string BufferReader::readMultibyteTerminatedStringBE(size_t maxBytesToRead, uint16 termination)
+{
+    char delimChars[2];
+    BE::getBytes(termination, delimChars);
+    return readMultibyteTerminatedString(maxBytesToRead, delimChars, true);
+}
+
+/*!
+ * \brief Reads a multibyte-terminated string.
+ *
+ * Advances the current position by the string length plus two bytes but maximal by \a maxBytesToRead.
+ *
+ * \param maxBytesToRead The maximal number of bytes to read.
+ * \param termination The two byte sized little endian value to be recognized as termination.
+ */
+string BufferReader::readMultibyteTerminatedStringLE(size_t maxBytesToRead, uint16 termination)
+{
+    char delimChars[2];
+    LE::getBytes(termination, delimChars);
+    return readMultibyteTerminatedString(maxBytesToRead, delimChars, true);
+}
+
+/*!
+ * \brief Reads \a count consecutive unsigned LEB128 values into \a values and advances the current position by their total length.
+ * \remarks Runs of single-byte values are decoded using SIMD instructions, see ConversionUtilities::decodeULeb128().
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded (the current position is not advanced
+ *         in that case) and ConversionException if a value exceeds 64 bit.
+ */
+void BufferReader::readULeb128(uint64 *values, size_t count)
+{
+    const size_t length = decodeULeb128(m_pos, m_end, values, count);
+    if(!length && count) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    m_pos += length;
+}
+
+/*!
+ * \brief Reads \a count consecutive signed LEB128 values into \a values and advances the current position by their total length.
+ * \remarks Runs of single-byte values are decoded using SIMD instructions, see ConversionUtilities::decodeSLeb128().
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded (the current position is not advanced
+ *         in that case) and ConversionException if a value exceeds 64 bit.
+ */
+void BufferReader::readSLeb128(int64 *values, size_t count)
+{
+    const size_t length = decodeSLeb128(m_pos, m_end, values, count);
+    if(!length && count) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    m_pos += length;
+}
+
+/*!
+ * \brief Reads \a count consecutive EBML variable size integers (VINTs) into \a values and advances the current position by their total length.
+ * \remarks Runs of single-byte values are decoded using SIMD instructions, see ConversionUtilities::decodeVInt().
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded (the current position is not advanced
+ *         in that case) and ConversionException if the first byte of a value is zero.
+ */
+void BufferReader::readVInt(uint64 *values, size_t count)
+{
+    const size_t length = decodeVInt(m_pos, m_end, values, count);
+    if(!length && count) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    m_pos += length;
+}
+
+/*!
+ * \brief Reads \a length bytes and computes the CRC-32 for that block of data.
+ * \remarks Ogg compatible version
+ * \sa BinaryReader::computeCrc32()
+ */
+uint32 BufferReader::readCrc32(size_t length)
+{
+    return BinaryReader::computeCrc32(consume(length), length);
+}
+
+} // namespace IoUtilities
@@ -0,0 +1,837 @@
+#ifndef IOUTILITIES_BUFFERREADER_H
+#define IOUTILITIES_BUFFERREADER_H
+
+#include "./catchiofailure.h"
+
+#include "../conversion/binaryconversion.h"
+#include "../conversion/varint.h"
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <utility>
+
+namespace IoUtilities
+{
+
+/*!
+ * \brief Refers to a string within the buffer of a BufferReader (pointer to the first character and length).
+ * \remarks The string is not terminated and only valid as long as the buffer is valid.
+ */
+typedef std::pair<const char *, std::size_t> StringView;
+
+class CPP_UTILITIES_EXPORT BufferReader
+{
+public:
+    BufferReader(const char *buffer, std::size_t bufferSize);
+    BufferReader(const char *buffer, const char *end);
+
+    const char *buffer() const;
+    const char *end() const;
+    const char *currentPosition() const;
+    std::size_t offset() const;
+    std::size_t size() const;
+    std::size_t bytesAvailable() const;
+    bool canRead() const;
+    void reset(const char *buffer, std::size_t bufferSize);
+    void reset(const char *buffer, const char *end);
+    void seek(std::size_t offset);
+    void skip(std::size_t count);
+    void read(char *buffer, std::size_t length);
+    void read(byte *buffer, std::size_t length);
+    void read(std::vector<char> &buffer, std::size_t length);
+    int16 readInt16BE();
+    uint16 readUInt16BE();
+    int32 readInt24BE();
+    uint32 readUInt24BE();
+    int32 readInt32BE();
+    uint32 readUInt32BE();
+    int64 readInt40BE();
+    uint64 readUInt40BE();
+    int64 readInt56BE();
+    uint64 readUInt56BE();
+    int64 readInt64BE();
+    uint64 readUInt64BE();
+    float32 readFloat32BE();
+    float64 readFloat64BE();
+    int16 readInt16LE();
+    uint16 readUInt16LE();
+    int32 readInt24LE();
+    uint32 readUInt24LE();
+    int32 readInt32LE();
+    uint32 readUInt32LE();
+    int64 readInt40LE();
+    uint64 readUInt40LE();
+    int64 readInt56LE();
+    uint64 readUInt56LE();
+    int64 readInt64LE();
+    uint64 readUInt64LE();
+    float32 readFloat32LE();
+    float64 readFloat64LE();
+    void readInt16BE(int16 *values, std::size_t count);
+    void readUInt16BE(uint16 *values, std::size_t count);
+    void readInt32BE(int32 *values, std::size_t count);
+    void readUInt32BE(uint32 *values, std::size_t count);
+    void readInt64BE(int64 *values, std::size_t count);
+    void readUInt64BE(uint64 *values, std::size_t count);
+    void readFloat32BE(float32 *values, std::size_t count);
+    void readFloat64BE(float64 *values, std::size_t count);
+    void readInt16LE(int16 *values, std::size_t count);
+    void readUInt16LE(uint16 *values, std::size_t count);
+    void readInt32LE(int32 *values, std::size_t count);
+    void readUInt32LE(uint32 *values, std::size_t count);
+    void readInt64LE(int64 *values, std::size_t count);
+    void readUInt64LE(uint64 *values, std::size_t count);
+    void readFloat32LE(float32 *values, std::size_t count);
+    void readFloat64LE(float64 *values, std::size_t count);
+    char readChar();
+    byte readByte();
+    bool readBool();
+    std::string readLengthPrefixedString();
+    std::string readString(std::size_t length);
+    std::string readTerminatedString(byte termination = 0);
+    std::string readTerminatedString(std::size_t maxBytesToRead, byte termination = 0);
+    StringView readStringView(std::size_t length);
+    StringView readTerminatedStringView(byte termination = 0);
+    StringView readTerminatedStringView(std::size_t maxBytesToRead, byte termination = 0);
+    std::string readMultibyteTerminatedStringBE(uint16 termination = 0);
+    std::string readMultibyteTerminatedStringLE(uint16 termination = 0);
+    std::string readMultibyteTerminatedStringBE(std::size_t maxBytesToRead, uint16 termination = 0);
+    std::string readMultibyteTerminatedStringLE(std::size_t maxBytesToRead, uint16 termination = 0);
+    void readLengthPrefixedString(std::string &result);
+    void readString(std::string &result, std::size_t length);
+    void readTerminatedString(std::string &result, byte termination = 0);
+    void readTerminatedString(std::string &result, std::size_t maxBytesToRead, byte termination = 0);
+    void skipLengthPrefixedString();
+    uint32 readSynchsafeUInt32BE();
+    float32 readFixed8BE();
+    float32 readFixed16BE();
+    uint32 readSynchsafeUInt32LE();
+    float32 readFixed8LE();
+    float32 readFixed16LE();
+    uint64 readULeb128();
+    int64 readSLeb128();
+    int64 readZigZagLeb128();
+    uint64 readVInt();
+    void readULeb128(uint64 *values, std::size_t count);
+    void readSLeb128(int64 *values, std::size_t count);
+    void readVInt(uint64 *values, std::size_t count);
+    uint32 readCrc32(std::size_t length);
+
+private:
+    const char *consume(std::size_t count);
+    uint32 readLengthPrefix();
+    std::string readMultibyteTerminatedString(std::size_t maxBytesToRead, const char *delimChars, bool bounded);
+
+    const char *m_buffer;
+    const char *m_pos;
+    const char *m_end;
+};
+
+/*!
+ * \brief Constructs a new BufferReader for the specified \a buffer.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+inline BufferReader::BufferReader(const char *buffer, std::size_t bufferSize) :
+    BufferReader(buffer, buffer + bufferSize)
+{}
+
+/*!
+ * \brief Constructs a new BufferReader for the range from \a buffer to \a end.
+ * \remarks
+ *  - Does not take ownership over the specified \a buffer.
+ *  - \a end must not be less than \a buffer.
+ */
+inline BufferReader::BufferReader(const char *buffer, const char *end) :
+    m_buffer(buffer),
+    m_pos(buffer),
+    m_end(end)
+{}
+
+/*!
+ * \brief Returns the start of the buffer the reader operates on.
+ */
+inline const char *BufferReader::buffer() const
+{
+    return m_buffer;
+}
+
+/*!
+ * \brief Returns the end of the buffer the reader operates on.
+ */
+inline const char *BufferReader::end() const
+{
+    return m_end;
+}
+
+/*!
+ * \brief Returns a pointer to the next byte which would be read.
+ */
+inline const char *BufferReader::currentPosition() const
+{
+    return m_pos;
+}
+
+/*!
+ * \brief Returns the current offset relative to the start of the buffer.
+ */
+inline std::size_t BufferReader::offset() const
+{
+    return static_cast<std::size_t>(m_pos - m_buffer);
+}
+
+/*!
+ * \brief Returns the size of the buffer the reader operates on.
+ */
+inline std::size_t BufferReader::size() const
+{
+    return static_cast<std::size_t>(m_end - m_buffer);
+}
+
+/*!
+ * \brief Returns the number of bytes which are still available to read.
+ */
+inline std::size_t BufferReader::bytesAvailable() const
+{
+    return static_cast<std::size_t>(m_end - m_pos);
+}
+
+/*!
+ * \brief Returns whether there is at least one byte left to read.
+ */
+inline bool BufferReader::canRead() const
+{
+    return m_pos < m_end;
+}
+
+/*!
+ * \brief Resets the reader to operate on the specified \a buffer.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+inline void BufferReader::reset(const char *buffer, std::size_t bufferSize)
+{
+    reset(buffer, buffer + bufferSize);
+}
+
+/*!
+ * \brief Resets the reader to operate on the range from \a buffer to \a end.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+inline void BufferReader::reset(const char *buffer, const char *end)
+{
+    m_buffer = m_pos = buffer;
+    m_end = end;
+}
+
+/*!
+ * \brief Sets the current position to the specified \a offset relative to the start of the buffer.
+ * \throws Throws std::ios_base::failure if \a offset exceeds the end of the buffer.
+ */
+inline void BufferReader::seek(std::size_t offset)
+{
+    if(offset > size()) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    m_pos = m_buffer + offset;
+}
+
+/*!
+ * \brief Advances the current position by \a count bytes without reading them.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded.
+ */
+inline void BufferReader::skip(std::size_t count)
+{
+    consume(count);
+}
+
+/*!
+ * \brief Returns the current position and advances it by \a count bytes.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded. The
+ *         current position is not altered in that case.
+ */
+inline const char *BufferReader::consume(std::size_t count)
+{
+    if(count > bytesAvailable()) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    const char *const pos = m_pos;
+    m_pos += count;
+    return pos;
+}
+
+/*!
+ * \brief Reads the specified number of characters from the buffer in the character array.
+ */
+inline void BufferReader::read(char *buffer, std::size_t length)
+{
+    std::memcpy(buffer, consume(length), length);
+}
+
+/*!
+ * \brief Reads the specified number of bytes from the buffer in the character array.
+ */
+inline void BufferReader::read(byte *buffer, std::size_t length)
+{
+    std::memcpy(buffer, consume(length), length);
+}
+
+/*!
+ * \brief Reads the specified number of bytes from the buffer in the specified \a buffer.
+ */
+inline void BufferReader::read(std::vector<char> &buffer, std::size_t length)
+{
+    const char *const src = consume(length);
+    buffer.assign(src, src + length);
+}
+
+/*!
+ * \brief Reads a 16-bit big endian signed integer and advances the current position by two bytes.
+ */
+inline int16 BufferReader::readInt16BE()
+{
+    return ConversionUtilities::BE::toInt16(consume(sizeof(int16)));
+}
+
+/*!
+ * \brief Reads a 16-bit big endian unsigned integer and advances the current position by two bytes.
+ */
+inline uint16 BufferReader::readUInt16BE()
+{
+    return ConversionUtilities::BE::toUInt16(consume(sizeof(uint16)));
+}
+
+/*!
+ * \brief Reads a 24-bit big endian signed integer and advances the current position by three bytes.
+ */
+inline int32 BufferReader::readInt24BE()
+{
+    return ConversionUtilities::BE::toInt24(consume(3));
+}
+
+/*!
+ * \brief Reads a 24-bit big endian unsigned integer and advances the current position by three bytes.
+ */
+inline uint32 BufferReader::readUInt24BE()
+{
+    return ConversionUtilities::BE::toUInt24(consume(3));
+}
+
+/*!
+ * \brief Reads a 32-bit big endian signed integer and advances the current position by four bytes.
+ */
+inline int32 BufferReader::readInt32BE()
+{
+    return ConversionUtilities::BE::toInt32(consume(sizeof(int32)));
+}
+
+/*!
+ * \brief Reads a 32-bit big endian unsigned integer and advances the current position by four bytes.
+ */
+inline uint32 BufferReader::readUInt32BE()
+{
+    return ConversionUtilities::BE::toUInt32(consume(sizeof(uint32)));
+}
+
+/*!
+ * \brief Reads a 40-bit big endian signed integer and advances the current position by five bytes.
+ */
+inline int64 BufferReader::readInt40BE()
+{
+    return ConversionUtilities::BE::toInt40(consume(5));
+}
+
+/*!
+ * \brief Reads a 40-bit big endian unsigned integer and advances the current position by five bytes.
+ */
+inline uint64 BufferReader::readUInt40BE()
+{
+    return ConversionUtilities::BE::toUInt40(consume(5));
+}
+
+/*!
+ * \brief Reads a 56-bit big endian signed integer and advances the current position by seven bytes.
+ */
+inline int64 BufferReader::readInt56BE()
+{
+    return ConversionUtilities::BE::toInt56(consume(7));
+}
+
+/*!
+ * \brief Reads a 56-bit big endian unsigned integer and advances the current position by seven bytes.
+ */
+inline uint64 BufferReader::readUInt56BE()
+{
+    return ConversionUtilities::BE::toUInt56(consume(7));
+}
+
+/*!
+ * \brief Reads a 64-bit big endian signed integer and advances the current position by eight bytes.
+ */
+inline int64 BufferReader::readInt64BE()
+{
+    return ConversionUtilities::BE::toInt64(consume(sizeof(int64)));
+}
+
+/*!
+ * \brief Reads a 64-bit big endian unsigned integer and advances the current position by eight bytes.
+ */
+inline uint64 BufferReader::readUInt64BE()
+{
+    return ConversionUtilities::BE::toUInt64(consume(sizeof(uint64)));
+}
+
+/*!
+ * \brief Reads a 32-bit big endian floating point value and advances the current position by four bytes.
+ */
+inline float32 BufferReader::readFloat32BE()
+{
+    return ConversionUtilities::BE::toFloat32(consume(sizeof(float32)));
+}
+
+/*!
+ * \brief Reads a 64-bit big endian floating point value and advances the current position by eight bytes.
+ */
+inline float64 BufferReader::readFloat64BE()
+{
+    return ConversionUtilities::BE::toFloat64(consume(sizeof(float64)));
+}
+
+/*!
+ * \brief Reads a 16-bit little endian signed integer and advances the current position by two bytes.
+ */
+inline int16 BufferReader::readInt16LE()
+{
+    return ConversionUtilities::LE::toInt16(consume(sizeof(int16)));
+}
+
+/*!
+ * \brief Reads a 16-bit little endian unsigned integer and advances the current position by two bytes.
+ */
+inline uint16 BufferReader::readUInt16LE()
+{
+    return ConversionUtilities::LE::toUInt16(consume(sizeof(uint16)));
+}
+
+/*!
+ * \brief Reads a 24-bit little endian signed integer and advances the current position by three bytes.
+ */
+inline int32 BufferReader::readInt24LE()
+{
+    return ConversionUtilities::LE::toInt24(consume(3));
+}
+
+/*!
+ * \brief Reads a 24-bit little endian unsigned integer and advances the current position by three bytes.
+ */
+inline uint32 BufferReader::readUInt24LE()
+{
+    return ConversionUtilities::LE::toUInt24(consume(3));
+}
+
+/*!
+ * \brief Reads a 32-bit little endian signed integer and advances the current position by four bytes.
+ */
+inline int32 BufferReader::readInt32LE()
+{
+    return ConversionUtilities::LE::toInt32(consume(sizeof(int32)));
+}
+
+/*!
+ * \brief Reads a 32-bit little endian unsigned integer and advances the current position by four bytes.
+ */
+inline uint32 BufferReader::readUInt32LE()
+{
+    return ConversionUtilities::LE::toUInt32(consume(sizeof(uint32)));
+}
+
+/*!
+ * \brief Reads a 40-bit little endian signed integer and advances the current position by five bytes.
+ */
+inline int64 BufferReader::readInt40LE()
+{
+    return ConversionUtilities::LE::toInt40(consume(5));
+}
+
+/*!
+ * \brief Reads a 40-bit little endian unsigned integer and advances the current position by five bytes.
+ */
+inline uint64 BufferReader::readUInt40LE()
+{
+    return ConversionUtilities::LE::toUInt40(consume(5));
+}
+
+/*!
+ * \brief Reads a 56-bit little endian signed integer and advances the current position by seven bytes.
+ */
+inline int64 BufferReader::readInt56LE()
+{
+    return ConversionUtilities::LE::toInt56(consume(7));
+}
+
+/*!
+ * \brief Reads a 56-bit little endian unsigned integer and advances the current position by seven bytes.
+ */
+inline uint64 BufferReader::readUInt56LE()
+{
+    return ConversionUtilities::LE::toUInt56(consume(7));
+}
+
+/*!
+ * \brief Reads a 64-bit little endian signed integer and advances the current position by eight bytes.
+ */
+inline int64 BufferReader::readInt64LE()
+{
+    return ConversionUtilities::LE::toInt64(consume(sizeof(int64)));
+}
+
+/*!
+ * \brief Reads a 64-bit little endian unsigned integer and advances the current position by eight bytes.
+ */
+inline uint64 BufferReader::readUInt64LE()
+{
+    return ConversionUtilities::LE::toUInt64(consume(sizeof(uint64)));
+}
+
+/*!
+ * \brief Reads a 32-bit little endian floating point value and advances the current position by four bytes.
+ */
+inline float32 BufferReader::readFloat32LE()
+{
+    return ConversionUtilities::LE::toFloat32(consume(sizeof(float32)));
+}
+
+/*!
+ * \brief Reads a 64-bit little endian floating point value and advances the current position by eight bytes.
+ */
+inline float64 BufferReader::readFloat64LE()
+{
+    return ConversionUtilities::LE::toFloat64(consume(sizeof(float64)));
+}
+
+/*!
+ * \brief Reads \a count 16-bit big endian signed integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readInt16BE(int16 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(int16)), count * sizeof(values[0]));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint16 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit big endian unsigned integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readUInt16BE(uint16 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(uint16)), count * sizeof(values[0]));
+    ConversionUtilities::BE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian signed integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readInt32BE(int32 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(int32)), count * sizeof(values[0]));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint32 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian unsigned integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readUInt32BE(uint32 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(uint32)), count * sizeof(values[0]));
+    ConversionUtilities::BE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian signed integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readInt64BE(int64 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(int64)), count * sizeof(values[0]));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint64 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian unsigned integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readUInt64BE(uint64 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(uint64)), count * sizeof(values[0]));
+    ConversionUtilities::BE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit big endian floating point values from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readFloat32BE(float32 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(float32)), count * sizeof(values[0]));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint32 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit big endian floating point values from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readFloat64BE(float64 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(float64)), count * sizeof(values[0]));
+    ConversionUtilities::BE::convertByteOrder(reinterpret_cast<uint64 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit little endian signed integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readInt16LE(int16 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(int16)), count * sizeof(values[0]));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint16 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 16-bit little endian unsigned integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readUInt16LE(uint16 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(uint16)), count * sizeof(values[0]));
+    ConversionUtilities::LE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian signed integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readInt32LE(int32 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(int32)), count * sizeof(values[0]));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint32 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian unsigned integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readUInt32LE(uint32 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(uint32)), count * sizeof(values[0]));
+    ConversionUtilities::LE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian signed integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readInt64LE(int64 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(int64)), count * sizeof(values[0]));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint64 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian unsigned integers from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readUInt64LE(uint64 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(uint64)), count * sizeof(values[0]));
+    ConversionUtilities::LE::convertByteOrder(values, count);
+}
+
+/*!
+ * \brief Reads \a count 32-bit little endian floating point values from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readFloat32LE(float32 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(float32)), count * sizeof(values[0]));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint32 *>(values), count);
+}
+
+/*!
+ * \brief Reads \a count 64-bit little endian floating point values from the buffer into the specified array.
+ * \remarks The whole block is read at once and converted in-place (using SIMD instructions if supported by the CPU).
+ */
+inline void BufferReader::readFloat64LE(float64 *values, std::size_t count)
+{
+    std::memcpy(values, consume(count * sizeof(float64)), count * sizeof(values[0]));
+    ConversionUtilities::LE::convertByteOrder(reinterpret_cast<uint64 *>(values), count);
+}
+
+/*!
+ * \brief Reads a single character and advances the current position by one byte.
+ */
+inline char BufferReader::readChar()
+{
+    return *consume(1);
+}
+
+/*!
+ * \brief Reads a single byte/unsigned character and advances the current position by one byte.
+ */
+inline byte BufferReader::readByte()
+{
+    return static_cast<byte>(*consume(1));
+}
+
+/*!
+ * \brief Reads a boolean value and advances the current position by one byte.
+ */
+inline bool BufferReader::readBool()
+{
+    return readByte() != 0;
+}
+
+/*!
+ * \brief Reads a string of the given \a length and advances the current position by \a length bytes.
+ */
+inline std::string BufferReader::readString(std::size_t length)
+{
+    return std::string(consume(length), length);
+}
+
+/*!
+ * \brief Reads a string of the given \a length into \a result and advances the current position by \a length bytes.
+ * \remarks The capacity of \a result is reused.
+ */
+inline void BufferReader::readString(std::string &result, std::size_t length)
+{
+    result.assign(consume(length), length);
+}
+
+/*!
+ * \brief Reads a string of the given \a length and advances the current position by \a length bytes.
+ * \remarks Returns a view into the buffer (nothing is allocated or copied).
+ */
+inline StringView BufferReader::readStringView(std::size_t length)
+{
+    return StringView(consume(length), length);
+}
+
+/*!
+ * \brief Reads a 32-bit big endian synchsafe integer and advances the current position by four bytes.
+ * \remarks Synchsafe integers appear in ID3 tags that are attached to an MP3 file.
+ * \sa <a href="http://id3.org/id3v2.4.0-structure">ID3 tag version 2.4.0 - Main Structure</a>
+ */
+inline uint32 BufferReader::readSynchsafeUInt32BE()
+{
+    return ConversionUtilities::toNormalInt(readUInt32BE());
+}
+
+/*!
+ * \brief Reads a 8.8 fixed point big endian representation and returns it as 32-bit floating point value.
+ */
+inline float32 BufferReader::readFixed8BE()
+{
+    return ConversionUtilities::toFloat32(readUInt16BE());
+}
+
+/*!
+ * \brief Reads a 16.16 fixed point big endian representation and returns it as 32-bit floating point value.
+ */
+inline float32 BufferReader::readFixed16BE()
+{
+    return ConversionUtilities::toFloat32(readUInt32BE());
+}
+
+/*!
+ * \brief Reads a 32-bit little endian synchsafe integer and advances the current position by four bytes.
+ * \remarks Synchsafe integers appear in ID3 tags that are attached to an MP3 file.
+ * \sa <a href="http://id3.org/id3v2.4.0-structure">ID3 tag version 2.4.0 - Main Structure</a>
+ */
+inline uint32 BufferReader::readSynchsafeUInt32LE()
+{
+    return ConversionUtilities::toNormalInt(readUInt32LE());
+}
+
+/*!
+ * \brief Reads a 8.8 fixed point little endian representation and returns it as 32-bit floating point value.
+ */
+inline float32 BufferReader::readFixed8LE()
+{
+    return ConversionUtilities::toFloat32(readUInt16LE());
+}
+
+/*!
+ * \brief Reads a 16.16 fixed point little endian representation and returns it as 32-bit floating point value.
+ */
+inline float32 BufferReader::readFixed16LE()
+{
+    return ConversionUtilities::toFloat32(readUInt32LE());
+}
+
+/*!
+ * \brief Reads an unsigned LEB128 value and advances the current position by its length (1 to 10 bytes).
+ * \remarks LEB128 is used by eg. DWARF, WebAssembly and Protocol Buffers (where it is called varint).
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded and ConversionException if the value exceeds 64 bit.
+ * \sa ConversionUtilities::decodeULeb128()
+ */
+inline uint64 BufferReader::readULeb128()
+{
+    uint64 value;
+    const std::size_t length = ConversionUtilities::decodeULeb128(m_pos, m_end, value);
+    if(!length) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    m_pos += length;
+    return value;
+}
+
+/*!
+ * \brief Reads a signed LEB128 value and advances the current position by its length (1 to 10 bytes).
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded and ConversionException if the value exceeds 64 bit.
+ * \sa ConversionUtilities::decodeSLeb128()
+ */
+inline int64 BufferReader::readSLeb128()
+{
+    int64 value;
+    const std::size_t length = ConversionUtilities::decodeSLeb128(m_pos, m_end, value);
+    if(!length) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    m_pos += length;
+    return value;
+}
+
+/*!
+ * \brief Reads a zig-zag encoded unsigned LEB128 value and advances the current position by its length (1 to 10 bytes).
+ * \remarks This is how Protocol Buffers stores "sint64" fields.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded and ConversionException if the value exceeds 64 bit.
+ * \sa ConversionUtilities::zigZagDecode()
+ */
+inline int64 BufferReader::readZigZagLeb128()
+{
+    return ConversionUtilities::zigZagDecode(readULeb128());
+}
+
+/*!
+ * \brief Reads an EBML variable size integer (VINT) and advances the current position by its length (1 to 8 bytes).
+ * \remarks VINTs with all data bits set (denoting elements of unknown size) are returned as ConversionUtilities::vIntUnknownSize.
+ * \throws Throws std::ios_base::failure if the end of the buffer is exceeded and ConversionException if the first
+ *         byte is zero (which would denote a length of more than 8 bytes).
+ * \sa ConversionUtilities::decodeVInt()
+ */
+inline uint64 BufferReader::readVInt()
+{
+    uint64 value;
+    const std::size_t length = ConversionUtilities::decodeVInt(m_pos, m_end, value);
+    if(!length) {
+        throwIoFailure("end of buffer exceeded");
+    }
+    m_pos += length;
+    return value;
+}
+
+}
+
+#endif // IOUTILITIES_BUFFERREADER_H
@@ -0,0 +1,543 @@
+#include "./checksum.h"
+
+#include "../conversion/binaryconversion.h"
+
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define IOUTILITIES_X86_SIMD
+# include <immintrin.h>
+#endif
+
+using namespace std;
+using namespace ConversionUtilities;
+
+namespace IoUtilities {
+
+/// \cond
+
+namespace {
+
+typedef uint32 (*ChecksumFunction)(uint32 checksum, const char *buffer, size_t length);
+
+/*!
+ * \brief The CrcTables struct holds the tables for computing a CRC of up to 32 bits using slicing-by-16.
+ *
+ * The table with the index k contains the CRC of each byte value followed by k zero bytes. So table 0
+ * is the regular table used to process one byte at a time.
+ *
+ * CRCs processed MSB-first are computed in a 32-bit register. CRCs with less than 32 bits are left-aligned
+ * within the register (so the polynomial and the initial value are shifted left by 32 - width bits).
+ * This way the same code can be used for all widths.
+ */
+struct CrcTables
+{
+    CrcTables(uint32 polynomial, bool reflected);
+    uint32 values[16][256];
+};
+
+CrcTables::CrcTables(uint32 polynomial, bool reflected)
+{
+    for(uint32 i = 0; i != 256; ++i) {
+        uint32 crc;
+        if(reflected) {
+            crc = i;
+            for(int bit = 0; bit != 8; ++bit) {
+                crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+            }
+        } else {
+            crc = i << 24;
+            for(int bit = 0; bit != 8; ++bit) {
+                crc = (crc & 0x80000000) ? (crc << 1) ^ polynomial : crc << 1;
+            }
+        }
+        values[0][i] = crc;
+    }
+    for(size_t k = 1; k != 16; ++k) {
+        for(size_t i = 0; i != 256; ++i) {
+            const uint32 previous = values[k - 1][i];
+            values[k][i] = reflected
+                    ? (previous >> 8) ^ values[0][previous & 0xFF]
+                    : (previous << 8) ^ values[0][previous >> 24];
+        }
+    }
+}
+
+/*!
+ * \brief Returns the tables for the specified (left-aligned) \a polynomial (which are computed on the first call).
+ */
+template<uint32 polynomial, bool reflected>
+const CrcTables &crcTables()
+{
+    static const CrcTables tables(polynomial, reflected);
+    return tables;
+}
+
+/*!
+ * \brief Returns the tables for the CRC-32 used by Ogg.
+ */
+inline const CrcTables &crc32Tables()
+{
+    return crcTables<0x04C11DB7, false>();
+}
+
+/*!
+ * \brief Returns the tables for the CRC-32C (Castagnoli).
+ */
+inline const CrcTables &crc32CTables()
+{
+    return crcTables<0x82F63B78, true>();
+}
+
+/*!
+ * \brief Updates the specified \a crc byte-wise (MSB-first).
+ */
+inline uint32 updateCrcBytewise(const CrcTables &tables, uint32 crc, const char *buffer, const char *end)
+{
+    for(; buffer != end; ++buffer) {
+        crc = (crc << 8) ^ tables.values[0][(crc >> 24) ^ static_cast<byte>(*buffer)];
+    }
+    return crc;
+}
+
+/*!
+ * \brief Updates the specified \a crc processing 16 bytes per iteration (slicing-by-16, MSB-first).
+ */
+uint32 updateCrcSlicing(const CrcTables &tables, uint32 crc, const char *buffer, size_t length)
+{
+    const auto &t = tables.values;
+    const char *const end = buffer + length;
+    for(const char *const blocksEnd = buffer + (length & ~static_cast<size_t>(15)); buffer != blocksEnd; buffer += 16) {
+        const uint32 a = crc ^ BE::toUInt32(buffer);
+        const uint32 b = BE::toUInt32(buffer + 4);
+        const uint32 c = BE::toUInt32(buffer + 8);
+        const uint32 d = BE::toUInt32(buffer + 12);
+        crc = t[15][a >> 24] ^ t[14][(a >> 16) & 0xFF] ^ t[13][(a >> 8) & 0xFF] ^ t[12][a & 0xFF]
+            ^ t[11][b >> 24] ^ t[10][(b >> 16) & 0xFF] ^ t[9][(b >> 8) & 0xFF] ^ t[8][b & 0xFF]
+            ^ t[7][c >> 24] ^ t[6][(c >> 16) & 0xFF] ^ t[5][(c >> 8) & 0xFF] ^ t[4][c & 0xFF]
+            ^ t[3][d >> 24] ^ t[2][(d >> 16) & 0xFF] ^ t[1][(d >> 8) & 0xFF] ^ t[0][d & 0xFF];
+    }
+    return updateCrcBytewise(tables, crc, buffer, end);
+}
+
+/*!
+ * \brief Updates the specified \a crc processing 16 bytes per iteration (slicing-by-16, LSB-first).
+ */
+uint32 updateReflectedCrcSlicing(const CrcTables &tables, uint32 crc, const char *buffer, size_t length)
+{
+    const auto &t = tables.values;
+    const char *const end = buffer + length;
+    for(const char *const blocksEnd = buffer + (length & ~static_cast<size_t>(15)); buffer != blocksEnd; buffer += 16) {
+        const uint32 a = crc ^ LE::toUInt32(buffer);
+        const uint32 b = LE::toUInt32(buffer + 4);
+        const uint32 c = LE::toUInt32(buffer + 8);
+        const uint32 d = LE::toUInt32(buffer + 12);
+        crc = t[15][a & 0xFF] ^ t[14][(a >> 8) & 0xFF] ^ t[13][(a >> 16) & 0xFF] ^ t[12][a >> 24]
+            ^ t[11][b & 0xFF] ^ t[10][(b >> 8) & 0xFF] ^ t[9][(b >> 16) & 0xFF] ^ t[8][b >> 24]
+            ^ t[7][c & 0xFF] ^ t[6][(c >> 8) & 0xFF] ^ t[5][(c >> 16) & 0xFF] ^ t[4][c >> 24]
+            ^ t[3][d & 0xFF] ^ t[2][(d >> 8) & 0xFF] ^ t[1][(d >> 16) & 0xFF] ^ t[0][d >> 24];
+    }
+    for(; buffer != end; ++buffer) {
+        crc = (crc >> 8) ^ t[0][(crc ^ static_cast<byte>(*buffer)) & 0xFF];
+    }
+    return crc;
+}
+
+/*!
+ * \brief Updates the specified \a crc using the CRC-32 tables.
+ */
+uint32 updateCrc32Slicing(uint32 crc, const char *buffer, size_t length)
+{
+    return updateCrcSlicing(crc32Tables(), crc, buffer, length);
+}
+
+/*!
+ * \brief Updates the specified (not inverted) \a crc using the CRC-32C tables.
+ */
+uint32 updateCrc32CSlicing(uint32 crc, const char *buffer, size_t length)
+{
+    return updateReflectedCrcSlicing(crc32CTables(), crc, buffer, length);
+}
+
+/*!
+ * \brief Specifies the greatest number of bytes which can be processed before the sums of Adler-32 must be reduced
+ *        modulo adler32Modulus to prevent overflows.
+ */
+constexpr size_t adler32MaxBlockSize = 5552;
+
+/*!
+ * \brief Specifies the modulus used by Adler-32 (the greatest prime less than 2^16).
+ */
+constexpr uint32 adler32Modulus = 65521;
+
+/*!
+ * \brief Updates the specified \a adler checksum.
+ */
+uint32 updateAdler32Scalar(uint32 adler, const char *buffer, size_t length)
+{
+    uint32 a = adler & 0xFFFF, b = adler >> 16;
+    while(length) {
+        size_t blockSize = min(length, adler32MaxBlockSize);
+        length -= blockSize;
+        for(; blockSize >= 4; blockSize -= 4, buffer += 4) {
+            a += static_cast<byte>(buffer[0]);
+            b += a;
+            a += static_cast<byte>(buffer[1]);
+            b += a;
+            a += static_cast<byte>(buffer[2]);
+            b += a;
+            a += static_cast<byte>(buffer[3]);
+            b += a;
+        }
+        for(; blockSize; --blockSize, ++buffer) {
+            a += static_cast<byte>(*buffer);
+            b += a;
+        }
+        a %= adler32Modulus;
+        b %= adler32Modulus;
+    }
+    return (b << 16) | a;
+}
+
+#ifdef IOUTILITIES_X86_SIMD
+
+/*!
+ * \brief Loads the specified 16 byte \a block reversing the order of the bytes using the specified \a mask.
+ */
+__attribute__((target("ssse3"))) inline __m128i loadReversed(const char *block, __m128i mask)
+{
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block)), mask);
+}
+
+/*!
+ * \brief Multiplies both halves of \a value with the corresponding constant (x^(n+64) mod P for the high half
+ *        and x^n mod P for the low half) which moves the represented polynomial n bits forward (modulo P).
+ */
+__attribute__((target("pclmul,sse2"))) inline __m128i foldCrc32(__m128i value, __m128i constants)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x11), _mm_clmulepi64_si128(value, constants, 0x00));
+}
+
+/*!
+ * \brief Updates the specified \a crc using carry-less multiplication (PCLMULQDQ).
+ *
+ * The data is processed in blocks of 16 bytes which are byte-reversed so bit i of a register is the coefficient of x^i.
+ * Four registers are folded 64 bytes forward per iteration. Then they are folded into one register which is finally reduced
+ * to 32 bits using Barrett reduction.
+ *
+ * \remarks Requires at least 64 bytes. Bytes after the last whole block of 16 bytes are processed using the tables.
+ * \sa "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction", Intel, 2009
+ */
+__attribute__((target("pclmul,ssse3"))) uint32 updateCrc32Pclmul(uint32 crc, const char *buffer, size_t length)
+{
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i fold512 = _mm_set_epi64x(0x8833794C, 0xE6228B11); // x^576 mod P, x^512 mod P
+    const __m128i fold128 = _mm_set_epi64x(0xC5B9CD4C, 0xE8A45605); // x^192 mod P, x^128 mod P
+    const __m128i reduce = _mm_set_epi64x(0x490D678D, 0xF200AA66); // x^64 mod P, x^96 mod P
+    const __m128i barrett = _mm_set_epi64x(0x104C11DB7, 0x104D101DF); // P, floor(x^64 / P)
+
+    const char *const end = buffer + length;
+    __m128i x0 = _mm_xor_si128(loadReversed(buffer, reverse), _mm_set_epi32(static_cast<int>(crc), 0, 0, 0));
+    __m128i x1 = loadReversed(buffer + 16, reverse);
+    __m128i x2 = loadReversed(buffer + 32, reverse);
+    __m128i x3 = loadReversed(buffer + 48, reverse);
+    for(buffer += 64; end - buffer >= 64; buffer += 64) {
+        x0 = _mm_xor_si128(foldCrc32(x0, fold512), loadReversed(buffer, reverse));
+        x1 = _mm_xor_si128(foldCrc32(x1, fold512), loadReversed(buffer + 16, reverse));
+        x2 = _mm_xor_si128(foldCrc32(x2, fold512), loadReversed(buffer + 32, reverse));
+        x3 = _mm_xor_si128(foldCrc32(x3, fold512), loadReversed(buffer + 48, reverse));
+    }
+    x1 = _mm_xor_si128(foldCrc32(x0, fold128), x1);
+    x2 = _mm_xor_si128(foldCrc32(x1, fold128), x2);
+    x0 = _mm_xor_si128(foldCrc32(x2, fold128), x3);
+    for(; end - buffer >= 16; buffer += 16) {
+        x0 = _mm_xor_si128(foldCrc32(x0, fold128), loadReversed(buffer, reverse));
+    }
+
+    // multiply by x^32 and reduce the 128-bit value to 64 bits
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(x0, reduce, 0x01), _mm_slli_si128(_mm_move_epi64(x0), 4));
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(x0, reduce, 0x11), _mm_move_epi64(x0));
+    // Barrett reduction to 32 bits
+    x1 = _mm_srli_si128(_mm_clmulepi64_si128(_mm_srli_epi64(x0, 32), barrett, 0x00), 4);
+    x0 = _mm_xor_si128(x0, _mm_clmulepi64_si128(x1, barrett, 0x10));
+    return updateCrcBytewise(crc32Tables(), static_cast<uint32>(_mm_cvtsi128_si32(x0)), buffer, end);
+}
+
+/*!
+ * \brief Updates the specified \a crc using PCLMULQDQ for large buffers and the tables otherwise.
+ */
+uint32 updateCrc32PclmulOrSlicing(uint32 crc, const char *buffer, size_t length)
+{
+    return length >= 128 ? updateCrc32Pclmul(crc, buffer, length) : updateCrc32Slicing(crc, buffer, length);
+}
+
+/*!
+ * \brief Updates the specified (not inverted) \a crc using the CRC32 instruction of SSE 4.2.
+ * \remarks The instruction computes the CRC-32C so this is not usable for the CRC-32 used by Ogg.
+ */
+__attribute__((target("sse4.2"))) uint32 updateCrc32CSse42(uint32 crc, const char *buffer, size_t length)
+{
+    const char *const end = buffer + length;
+#ifdef __x86_64__
+    uint64 crc64 = crc;
+    for(; end - buffer >= 8; buffer += 8) {
+        crc64 = _mm_crc32_u64(crc64, LE::toUInt64(buffer));
+    }
+    crc = static_cast<uint32>(crc64);
+#else
+    for(; end - buffer >= 4; buffer += 4) {
+        crc = _mm_crc32_u32(crc, LE::toUInt32(buffer));
+    }
+#endif
+    for(; buffer != end; ++buffer) {
+        crc = _mm_crc32_u8(crc, static_cast<byte>(*buffer));
+    }
+    return crc;
+}
+
+/*!
+ * \brief Returns the sum of the four 32-bit integers in \a value.
+ */
+__attribute__((target("sse2"))) inline uint32 sumUInt32s(__m128i value)
+{
+    value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+    value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+    return static_cast<uint32>(_mm_cvtsi128_si32(value));
+}
+
+/*!
+ * \brief Updates the specified \a adler checksum processing 32 bytes per iteration using SSSE3.
+ *
+ * The first sum is the sum of the bytes (computed using PSADBW). The second sum is the sum of the bytes
+ * weighted by their distance from the end of a block (computed using PMADDUBSW) plus 32 times the first
+ * sum at the beginning of each block.
+ *
+ * \remarks Bytes after the last whole block of 32 bytes are processed using the scalar implementation.
+ */
+__attribute__((target("ssse3"))) uint32 updateAdler32Ssse3(uint32 adler, const char *buffer, size_t length)
+{
+    const __m128i weights1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+    const __m128i weights2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+
+    uint32 a = adler & 0xFFFF, b = adler >> 16;
+    for(size_t blocks = length / 32; blocks; ) {
+        size_t blocksToProcess = min(blocks, adler32MaxBlockSize / 32);
+        blocks -= blocksToProcess;
+        length -= blocksToProcess * 32;
+        __m128i previousSumsOfA = _mm_cvtsi32_si128(static_cast<int>(a * blocksToProcess));
+        __m128i sumsOfB = _mm_cvtsi32_si128(static_cast<int>(b));
+        __m128i sumsOfA = zero;
+        do {
+            const __m128i bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer));
+            const __m128i bytes2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + 16));
+            previousSumsOfA = _mm_add_epi32(previousSumsOfA, sumsOfA);
+            sumsOfA = _mm_add_epi32(sumsOfA, _mm_sad_epu8(bytes1, zero));
+            sumsOfB = _mm_add_epi32(sumsOfB, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, weights1), ones));
+            sumsOfA = _mm_add_epi32(sumsOfA, _mm_sad_epu8(bytes2, zero));
+            sumsOfB = _mm_add_epi32(sumsOfB, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, weights2), ones));
+            buffer += 32;
+        } while(--blocksToProcess);
+        sumsOfB = _mm_add_epi32(sumsOfB, _mm_slli_epi32(previousSumsOfA, 5));
+        a = (a + sumUInt32s(sumsOfA)) % adler32Modulus;
+        b = sumUInt32s(sumsOfB) % adler32Modulus;
+    }
+    return updateAdler32Scalar((b << 16) | a, buffer, length);
+}
+
+/*!
+ * \brief Updates the specified \a adler checksum using SSSE3 for large buffers and the scalar implementation otherwise.
+ */
+uint32 updateAdler32Ssse3OrScalar(uint32 adler, const char *buffer, size_t length)
+{
+    return length >= 64 ? updateAdler32Ssse3(adler, buffer, length) : updateAdler32Scalar(adler, buffer, length);
+}
+
+#endif
+
+/*!
+ * \brief Returns the fastest implementation to compute the CRC-32 supported by the CPU.
+ */
+ChecksumFunction selectCrc32Function()
+{
+#ifdef IOUTILITIES_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3")) {
+        return &updateCrc32PclmulOrSlicing;
+    }
+#endif
+    return &updateCrc32Slicing;
+}
+
+/*!
+ * \brief Returns the fastest implementation to compute the CRC-32C supported by the CPU.
+ */
+ChecksumFunction selectCrc32CFunction()
+{
+#ifdef IOUTILITIES_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("sse4.2")) {
+        return &updateCrc32CSse42;
+    }
+#endif
+    return &updateCrc32CSlicing;
+}
+
+/*!
+ * \brief Returns the fastest implementation to compute the Adler-32 checksum supported by the CPU.
+ */
+ChecksumFunction selectAdler32Function()
+{
+#ifdef IOUTILITIES_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("ssse3")) {
+        return &updateAdler32Ssse3OrScalar;
+    }
+#endif
+    return &updateAdler32Scalar;
+}
+
+}
+
+/// \endcond
+
+/*!
+ * \class IoUtilities::Checksum
+ * \brief The Checksum class is the common interface of all checksum accumulators.
+ *
+ * Each accumulator (Crc32, Crc32C, Crc16, Crc8 and Adler32) provides the same interface:
+ *  - The constructor takes the checksum of the data which has already been processed. It defaults to the
+ *    initial value of the algorithm.
+ *  - update() processes the next block of data.
+ *  - value() returns the checksum of all data processed so far.
+ *  - reset() restarts the computation.
+ *  - The static compute() method computes the checksum of a single buffer. It can be chained by passing
+ *    the result for the previous data.
+ *
+ * The implementation is selected at runtime depending on the features of the CPU (if applicable).
+ *
+ * Only update() is virtual so an accumulator can be assigned to a BinaryReader or BinaryWriter to compute
+ * the checksum of a region as a side effect of reading or writing it:
+ * \code
+ * Crc32C crc;
+ * reader.setChecksum(&crc);
+ * const auto header = reader.readUInt32BE();
+ * const auto payload = reader.readString(header & 0xFFFF);
+ * reader.setChecksum(nullptr);
+ * if(reader.readUInt32LE() != crc.value()) {
+ *     // handle corrupted data
+ * }
+ * \endcode
+ * The accumulators can also be used with CopyHelper::checksumCopy().
+ */
+
+/*!
+ * \brief Destroys the checksum accumulator.
+ */
+Checksum::~Checksum()
+{}
+
+/*!
+ * \class IoUtilities::Crc32
+ * \brief The Crc32 class computes the CRC-32 incrementally.
+ *
+ * The CRC-32 variant used by Ogg is computed (polynomial 0x04C11DB7, processed MSB-first, initial value
+ * zero, no final XOR). So the result equals BinaryReader::computeCrc32() for the concatenation of all
+ * buffers passed to update():
+ * \code
+ * Crc32 crc;
+ * CopyHelper<0x4000> copyHelper;
+ * copyHelper.checksumCopy(input, output, size, crc);
+ * const auto checksum = crc.value();
+ * \endcode
+ *
+ * The CRC-32 used by MPEG-2 transport streams (eg. for PSI tables) is computed when passing 0xFFFFFFFF as initial value.
+ */
+
+/*!
+ * \brief Computes the CRC-32 of the specified \a buffer.
+ * \param crc Specifies the CRC of the data which has already been processed (zero if there is no such data).
+ * \remarks
+ *  - Uses carry-less multiplication (PCLMULQDQ) for large buffers if supported by the CPU (determined at runtime).
+ *    Otherwise uses slicing-by-16 tables.
+ *  - Ogg compatible version
+ */
+uint32 Crc32::compute(const char *buffer, size_t length, uint32 crc)
+{
+    static const ChecksumFunction updateCrc32 = selectCrc32Function();
+    return updateCrc32(crc, buffer, length);
+}
+
+/*!
+ * \class IoUtilities::Crc32C
+ * \brief The Crc32C class computes the CRC-32C (Castagnoli) incrementally.
+ *
+ * The CRC-32C is used by iSCSI, SCTP, Btrfs and ext4 among others (polynomial 0x1EDC6F41, processed LSB-first,
+ * initial value and final XOR 0xFFFFFFFF).
+ */
+
+/*!
+ * \brief Computes the CRC-32C of the specified \a buffer.
+ * \param crc Specifies the CRC of the data which has already been processed (zero if there is no such data).
+ * \remarks Uses the CRC32 instruction if SSE 4.2 is supported by the CPU (determined at runtime).
+ *          Otherwise uses slicing-by-16 tables.
+ */
+uint32 Crc32C::compute(const char *buffer, size_t length, uint32 crc)
+{
+    static const ChecksumFunction updateCrc32C = selectCrc32CFunction();
+    return ~updateCrc32C(~crc, buffer, length);
+}
+
+/*!
+ * \class IoUtilities::Crc16
+ * \brief The Crc16 class computes the CRC-16 used by FLAC and MPEG audio frames incrementally.
+ *
+ * The polynomial 0x8005 is processed MSB-first without final XOR. The initial value is zero for FLAC frames
+ * and 0xFFFF for the (optional) CRC of MPEG audio frames.
+ */
+
+/*!
+ * \brief Computes the CRC-16 of the specified \a buffer.
+ * \param crc Specifies the CRC of the data which has already been processed or the initial value.
+ * \remarks Uses slicing-by-16 tables.
+ */
+uint16 Crc16::compute(const char *buffer, size_t length, uint16 crc)
+{
+    return static_cast<uint16>(updateCrcSlicing(crcTables<0x80050000, false>(), static_cast<uint32>(crc) << 16, buffer, length) >> 16);
+}
+
+/*!
+ * \class IoUtilities::Crc8
+ * \brief The Crc8 class computes the CRC-8 used by FLAC frame headers incrementally.
+ *
+ * The polynomial 0x07 is processed MSB-first without final XOR. The initial value is zero.
+ */
+
+/*!
+ * \brief Computes the CRC-8 of the specified \a buffer.
+ * \param crc Specifies the CRC of the data which has already been processed or the initial value.
+ * \remarks Uses slicing-by-16 tables.
+ */
+byte Crc8::compute(const char *buffer, size_t length, byte crc)
+{
+    return static_cast<byte>(updateCrcSlicing(crcTables<0x07000000, false>(), static_cast<uint32>(crc) << 24, buffer, length) >> 24);
+}
+
+/*!
+ * \class IoUtilities::Adler32
+ * \brief The Adler32 class computes the Adler-32 checksum used by zlib incrementally.
+ */
+
+/*!
+ * \brief Computes the Adler-32 checksum of the specified \a buffer.
+ * \param adler Specifies the checksum of the data which has already been processed (one if there is no such data).
+ * \remarks Processes 32 bytes per iteration if SSSE3 is supported by the CPU (determined at runtime).
+ */
+uint32 Adler32::compute(const char *buffer, size_t length, uint32 adler)
+{
+    static const ChecksumFunction updateAdler32 = selectAdler32Function();
+    return updateAdler32(adler, buffer, length);
+}
+
+} // namespace IoUtilities
@@ -0,0 +1,256 @@
+#ifndef IOUTILITIES_CHECKSUM_H
+#define IOUTILITIES_CHECKSUM_H
+
+#include "../conversion/types.h"
+#include "../global.h"
+
+#include <cstddef>
+
+namespace IoUtilities {
+
+class CPP_UTILITIES_EXPORT Checksum
+{
+public:
+    virtual ~Checksum();
+
+    virtual void update(const char *buffer, std::size_t length) = 0;
+};
+
+class CPP_UTILITIES_EXPORT Crc32 final : public Checksum
+{
+public:
+    Crc32(uint32 crc = 0);
+
+    void update(const char *buffer, std::size_t length) override;
+    uint32 value() const;
+    void reset(uint32 crc = 0);
+    static uint32 compute(const char *buffer, std::size_t length, uint32 crc = 0);
+
+private:
+    uint32 m_crc;
+};
+
+/*!
+ * \brief Constructs a new accumulator.
+ * \param crc Specifies the CRC of the data which has already been processed (zero if there is no such data).
+ */
+inline Crc32::Crc32(uint32 crc) :
+    m_crc(crc)
+{}
+
+/*!
+ * \brief Processes the specified \a buffer.
+ */
+inline void Crc32::update(const char *buffer, std::size_t length)
+{
+    m_crc = compute(buffer, length, m_crc);
+}
+
+/*!
+ * \brief Returns the CRC-32 of all data processed so far.
+ */
+inline uint32 Crc32::value() const
+{
+    return m_crc;
+}
+
+/*!
+ * \brief Resets the accumulator.
+ * \param crc Specifies the CRC of the data which has already been processed (zero if there is no such data).
+ */
+inline void Crc32::reset(uint32 crc)
+{
+    m_crc = crc;
+}
+
+class CPP_UTILITIES_EXPORT Crc32C final : public Checksum
+{
+public:
+    Crc32C(uint32 crc = 0);
+
+    void update(const char *buffer, std::size_t length) override;
+    uint32 value() const;
+    void reset(uint32 crc = 0);
+    static uint32 compute(const char *buffer, std::size_t length, uint32 crc = 0);
+
+private:
+    uint32 m_crc;
+};
+
+/*!
+ * \brief Constructs a new accumulator.
+ * \param crc Specifies the CRC of the data which has already been processed (zero if there is no such data).
+ */
+inline Crc32C::Crc32C(uint32 crc) :
+    m_crc(crc)
+{}
+
+/*!
+ * \brief Processes the specified \a buffer.
+ */
+inline void Crc32C::update(const char *buffer, std::size_t length)
+{
+    m_crc = compute(buffer, length, m_crc);
+}
+
+/*!
+ * \brief Returns the CRC-32C of all data processed so far.
+ */
+inline uint32 Crc32C::value() const
+{
+    return m_crc;
+}
+
+/*!
+ * \brief Resets the accumulator.
+ * \param crc Specifies the CRC of the data which has already been processed (zero if there is no such data).
+ */
+inline void Crc32C::reset(uint32 crc)
+{
+    m_crc = crc;
+}
+
+class CPP_UTILITIES_EXPORT Crc16 final : public Checksum
+{
+public:
+    Crc16(uint16 crc = 0);
+
+    void update(const char *buffer, std::size_t length) override;
+    uint16 value() const;
+    void reset(uint16 crc = 0);
+    static uint16 compute(const char *buffer, std::size_t length, uint16 crc = 0);
+
+private:
+    uint16 m_crc;
+};
+
+/*!
+ * \brief Constructs a new accumulator.
+ * \param crc Specifies the initial value (zero for FLAC frames, 0xFFFF for MPEG audio frames).
+ */
+inline Crc16::Crc16(uint16 crc) :
+    m_crc(crc)
+{}
+
+/*!
+ * \brief Processes the specified \a buffer.
+ */
+inline void Crc16::update(const char *buffer, std::size_t length)
+{
+    m_crc = compute(buffer, length, m_crc);
+}
+
+/*!
+ * \brief Returns the CRC-16 of all data processed so far.
+ */
+inline uint16 Crc16::value() const
+{
+    return m_crc;
+}
+
+/*!
+ * \brief Resets the accumulator.
+ * \param crc Specifies the initial value (zero for FLAC frames, 0xFFFF for MPEG audio frames).
+ */
+inline void Crc16::reset(uint16 crc)
+{
+    m_crc = crc;
+}
+
+class CPP_UTILITIES_EXPORT Crc8 final : public Checksum
+{
+public:
+    Crc8(byte crc = 0);
+
+    void update(const char *buffer, std::size_t length) override;
+    byte value() const;
+    void reset(byte crc = 0);
+    static byte compute(const char *buffer, std::size_t length, byte crc = 0);
+
+private:
+    byte m_crc;
+};
+
+/*!
+ * \brief Constructs a new accumulator.
+ * \param crc Specifies the initial value (zero for FLAC frame headers).
+ */
+inline Crc8::Crc8(byte crc) :
+    m_crc(crc)
+{}
+
+/*!
+ * \brief Processes the specified \a buffer.
+ */
+inline void Crc8::update(const char *buffer, std::size_t length)
+{
+    m_crc = compute(buffer, length, m_crc);
+}
+
+/*!
+ * \brief Returns the CRC-8 of all data processed so far.
+ */
+inline byte Crc8::value() const
+{
+    return m_crc;
+}
+
+/*!
+ * \brief Resets the accumulator.
+ * \param crc Specifies the initial value (zero for FLAC frame headers).
+ */
+inline void Crc8::reset(byte crc)
+{
+    m_crc = crc;
+}
+
+class CPP_UTILITIES_EXPORT Adler32 final : public Checksum
+{
+public:
+    Adler32(uint32 adler = 1);
+
+    void update(const char *buffer, std::size_t length) override;
+    uint32 value() const;
+    void reset(uint32 adler = 1);
+    static uint32 compute(const char *buffer, std::size_t length, uint32 adler = 1);
+
+private:
+    uint32 m_adler;
+};
+
+/*!
+ * \brief Constructs a new accumulator.
+ * \param adler Specifies the checksum of the data which has already been processed (one if there is no such data).
+ */
+inline Adler32::Adler32(uint32 adler) :
+    m_adler(adler)
+{}
+
+/*!
+ * \brief Processes the specified \a buffer.
+ */
+inline void Adler32::update(const char *buffer, std::size_t length)
+{
+    m_adler = compute(buffer, length, m_adler);
+}
+
+/*!
+ * \brief Returns the Adler-32 checksum of all data processed so far.
+ */
+inline uint32 Adler32::value() const
+{
+    return m_adler;
+}
+
+/*!
+ * \brief Resets the accumulator.
+ * \param adler Specifies the checksum of the data which has already been processed (one if there is no such data).
+ */
+inline void Adler32::reset(uint32 adler)
+{
+    m_adler = adler;
+}
+
+} // namespace IoUtilities
+
+#endif // IOUTILITIES_CHECKSUM_H
@@ -0,0 +1,375 @@
+#include "./copy.h"
+#include "./catchiofailure.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef PLATFORM_UNIX
+# include <cerrno>
+# include <unistd.h>
+#endif
+#ifdef PLATFORM_LINUX
+# include <fcntl.h>
+# include <sys/sendfile.h>
+# include <sys/syscall.h>
+#endif
+
+using namespace std;
+using namespace ChronoUtilities;
+
+namespace IoUtilities {
+
+/*!
+ * \brief Constructs empty statistics.
+ */
+CopyStatistics::CopyStatistics() :
+    bytesCopied(0)
+{}
+
+/*!
+ * \brief Returns the throughput in bytes per second (or zero if the duration is zero).
+ */
+double CopyStatistics::throughput() const
+{
+    const double seconds = duration.totalSeconds();
+    return seconds > 0.0 ? static_cast<double>(bytesCopied) / seconds : 0.0;
+}
+
+/// \cond
+
+namespace {
+
+/*!
+ * \brief Returns the time elapsed since \a start as TimeSpan.
+ */
+TimeSpan elapsedSince(chrono::steady_clock::time_point start)
+{
+    return TimeSpan(static_cast<int64>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / 100));
+}
+
+/*!
+ * \brief The AsyncCopyState struct holds the state shared by the reader thread and the writer of copyAsynchronously().
+ *
+ * The buffers are used as ring. The reader fills the block with the number \a blocksRead (modulo the number of buffers)
+ * as long as less than the number of buffers are pending. The writer writes the block with the number \a blocksWritten.
+ */
+struct AsyncCopyState
+{
+    AsyncCopyState(istream &input, size_t count, vector<char *> &&buffers, size_t bufferSize);
+    void read();
+    void stop();
+
+    istream &input;
+    const size_t count;
+    const vector<char *> buffers;
+    const size_t bufferSize;
+    mutex mtx;
+    condition_variable blockRead;
+    condition_variable blockWritten;
+    size_t blocksRead;
+    size_t blocksWritten;
+    bool stopped;
+    exception_ptr readError;
+    TimeSpan readerWaitTime;
+};
+
+AsyncCopyState::AsyncCopyState(istream &input, size_t count, vector<char *> &&buffers, size_t bufferSize) :
+    input(input),
+    count(count),
+    buffers(move(buffers)),
+    bufferSize(bufferSize),
+    blocksRead(0),
+    blocksWritten(0),
+    stopped(false)
+{}
+
+/*!
+ * \brief Reads the blocks (invoked within the reader thread).
+ */
+void AsyncCopyState::read()
+{
+    try {
+        for(size_t bytesRead = 0, blockNumber = 0; bytesRead < count; ++blockNumber) {
+            {
+                unique_lock<mutex> lock(mtx);
+                if(blockNumber - blocksWritten >= buffers.size()) {
+                    const auto waitStart = chrono::steady_clock::now();
+                    blockWritten.wait(lock, [this, blockNumber] {
+                        return stopped || blockNumber - blocksWritten < buffers.size();
+                    });
+                    readerWaitTime += elapsedSince(waitStart);
+                }
+                if(stopped) {
+                    return;
+                }
+            }
+            const size_t blockSize = min(count - bytesRead, bufferSize);
+            input.read(buffers[blockNumber % buffers.size()], static_cast<streamsize>(blockSize));
+            bytesRead += blockSize;
+            {
+                lock_guard<mutex> lock(mtx);
+                blocksRead = blockNumber + 1;
+            }
+            blockRead.notify_one();
+        }
+    } catch(...) {
+        {
+            lock_guard<mutex> lock(mtx);
+            readError = current_exception();
+        }
+        blockRead.notify_one();
+    }
+}
+
+/*!
+ * \brief Stops the reader (invoked by the writer).
+ */
+void AsyncCopyState::stop()
+{
+    {
+        lock_guard<mutex> lock(mtx);
+        stopped = true;
+    }
+    blockWritten.notify_one();
+}
+
+}
+
+/// \endcond
+
+/*!
+ * \brief Copies \a count bytes from \a input to \a output using a separate thread for reading.
+ *
+ * The specified \a buffer is used as first buffer. Additional \a bufferCount - 1 buffers of the specified \a bufferSize
+ * are allocated. The reader thread fills the buffers as long as free buffers are available while the calling thread
+ * writes the filled buffers.
+ *
+ * Copying is aborted when \a isAborted returns true. The current progress is reported by calling the specified \a callback function.
+ * Both functions are invoked from the calling thread after writing a block.
+ *
+ * \returns Returns statistics about the throughput and which side had to wait for the other.
+ * \throws Throws std::ios_base::failure (or whatever the streams throw) when an IO error occurs if an exception mask has been set
+ *         using std::ios::exceptions(). Errors when reading are propagated to the calling thread.
+ * \sa CopyHelper::asyncCopy()
+ */
+CopyStatistics copyAsynchronously(istream &input, ostream &output, size_t count, char *buffer, size_t bufferSize, size_t bufferCount, const std::function<bool ()> &isAborted, const std::function<void (double)> &callback)
+{
+    CopyStatistics statistics;
+    const auto start = chrono::steady_clock::now();
+    if(!count) {
+        callback(1.0);
+        return statistics;
+    }
+
+    // allocate additional buffers (at least one is required to read and write at the same time)
+    bufferCount = max<size_t>(bufferCount, 2);
+    unique_ptr<char[]> additionalBuffers(new char[(bufferCount - 1) * bufferSize]);
+    vector<char *> buffers;
+    buffers.reserve(bufferCount);
+    buffers.push_back(buffer);
+    for(size_t i = 0; i != bufferCount - 1; ++i) {
+        buffers.push_back(additionalBuffers.get() + i * bufferSize);
+    }
+
+    // start reader
+    AsyncCopyState state(input, count, move(buffers), bufferSize);
+    thread reader(&AsyncCopyState::read, &state);
+    const auto finish = [&] {
+        state.stop();
+        reader.join();
+        statistics.duration = elapsedSince(start);
+        statistics.readerWaitTime = state.readerWaitTime;
+    };
+
+    // write blocks as soon as they have been read
+    try {
+        for(size_t blockNumber = 0; ; ++blockNumber) {
+            {
+                unique_lock<mutex> lock(state.mtx);
+                if(blockNumber >= state.blocksRead && !state.readError) {
+                    const auto waitStart = chrono::steady_clock::now();
+                    state.blockRead.wait(lock, [&state, blockNumber] {
+                        return blockNumber < state.blocksRead || state.readError;
+                    });
+                    statistics.writerWaitTime += elapsedSince(waitStart);
+                }
+                if(blockNumber >= state.blocksRead) {
+                    rethrow_exception(state.readError);
+                }
+            }
+            const size_t blockSize = min<size_t>(count - statistics.bytesCopied, bufferSize);
+            output.write(state.buffers[blockNumber % state.buffers.size()], static_cast<streamsize>(blockSize));
+            statistics.bytesCopied += blockSize;
+            {
+                lock_guard<mutex> lock(state.mtx);
+                state.blocksWritten = blockNumber + 1;
+            }
+            state.blockWritten.notify_one();
+            if(statistics.bytesCopied == count) {
+                break;
+            }
+            if(isAborted()) {
+                finish();
+                return statistics;
+            }
+            callback(static_cast<double>(statistics.bytesCopied) / count);
+        }
+    } catch(...) {
+        finish();
+        throw;
+    }
+    finish();
+    callback(1.0);
+    return statistics;
+}
+
+#ifdef PLATFORM_UNIX
+
+/// \cond
+
+namespace {
+
+#ifdef PLATFORM_LINUX
+
+typedef ssize_t (*KernelCopyFunction)(int inputFileDescriptor, int outputFileDescriptor, size_t count);
+
+/*!
+ * \brief Copies data between files within the file system (might even share the data blocks).
+ * \remarks Invokes the system call directly because glibc provides no wrapper before 2.27.
+ */
+ssize_t copyFileRange(int inputFileDescriptor, int outputFileDescriptor, size_t count)
+{
+#ifdef SYS_copy_file_range
+    return syscall(SYS_copy_file_range, inputFileDescriptor, nullptr, outputFileDescriptor, nullptr, count, 0u);
+#else
+    VAR_UNUSED(inputFileDescriptor)
+    VAR_UNUSED(outputFileDescriptor)
+    VAR_UNUSED(count)
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+/*!
+ * \brief Copies data from a file which supports mmap()-like operations to any file descriptor.
+ */
+ssize_t sendFile(int inputFileDescriptor, int outputFileDescriptor, size_t count)
+{
+    return sendfile(outputFileDescriptor, inputFileDescriptor, nullptr, count);
+}
+
+/*!
+ * \brief Copies data from or to a pipe.
+ */
+ssize_t spliceData(int inputFileDescriptor, int outputFileDescriptor, size_t count)
+{
+    return splice(inputFileDescriptor, nullptr, outputFileDescriptor, nullptr, count, SPLICE_F_MOVE);
+}
+
+/*!
+ * \brief Copies up to \a count bytes using the specified \a copyFunction.
+ * \returns Returns the number of bytes copied. Copying stops early if the function is not applicable to the file
+ *          descriptors or returns zero. Then the next function is supposed to continue (the final fallback detects
+ *          whether the end of the input has actually been reached).
+ * \throws Throws std::ios_base::failure when an IO error occurs.
+ */
+size_t copyWithinKernel(KernelCopyFunction copyFunction, int inputFileDescriptor, int outputFileDescriptor, size_t count)
+{
+    size_t bytesCopied = 0;
+    while(bytesCopied < count) {
+        const ssize_t res = copyFunction(inputFileDescriptor, outputFileDescriptor, count - bytesCopied);
+        if(res > 0) {
+            bytesCopied += static_cast<size_t>(res);
+            continue;
+        }
+        if(res < 0) {
+            switch(errno) {
+            case EINTR:
+                continue;
+            case ENOSYS:
+            case EXDEV:
+            case EINVAL:
+            case EOPNOTSUPP:
+            case EBADF:
+            case EPERM:
+                break;
+            default:
+                throwIoFailure("unable to copy data within the kernel");
+            }
+        }
+        break;
+    }
+    return bytesCopied;
+}
+
+#endif
+
+/*!
+ * \brief Copies \a count bytes using read() and write().
+ * \throws Throws std::ios_base::failure when an IO error occurs or the end of the input is reached prematurely.
+ */
+void copyViaBuffer(int inputFileDescriptor, int outputFileDescriptor, size_t count, char *buffer, size_t bufferSize)
+{
+    while(count) {
+        const ssize_t bytesRead = read(inputFileDescriptor, buffer, min(count, bufferSize));
+        if(bytesRead < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            throwIoFailure("read failed");
+        }
+        if(!bytesRead) {
+            throwIoFailure("end of input reached");
+        }
+        for(const char *i = buffer, *end = buffer + bytesRead; i != end; ) {
+            const ssize_t bytesWritten = write(outputFileDescriptor, i, static_cast<size_t>(end - i));
+            if(bytesWritten < 0) {
+                if(errno == EINTR) {
+                    continue;
+                }
+                throwIoFailure("write failed");
+            }
+            i += bytesWritten;
+        }
+        count -= static_cast<size_t>(bytesRead);
+    }
+}
+
+}
+
+/// \endcond
+
+/*!
+ * \brief Copies \a count bytes from \a inputFileDescriptor to \a outputFileDescriptor.
+ *
+ * Under Linux the data is copied within the kernel using the first of the following system calls which
+ * is applicable to the file descriptors:
+ *  1. copy_file_range() - between regular files (might even share the data blocks, eg. on Btrfs or NFS)
+ *  2. sendfile() - from regular files to any file descriptor
+ *  3. splice() - from or to pipes
+ *
+ * Otherwise (and on other platforms) the data is copied using read() and write() and the specified \a buffer.
+ * Reading and writing starts at the current offsets of the file descriptors which are advanced accordingly.
+ *
+ * \throws Throws std::ios_base::failure when an IO error occurs or the end of the input is reached prematurely.
+ * \sa CopyHelper::copy()
+ */
+void copyFileDescriptorData(int inputFileDescriptor, int outputFileDescriptor, size_t count, char *buffer, size_t bufferSize)
+{
+#ifdef PLATFORM_LINUX
+    count -= copyWithinKernel(&copyFileRange, inputFileDescriptor, outputFileDescriptor, count);
+    count -= copyWithinKernel(&sendFile, inputFileDescriptor, outputFileDescriptor, count);
+    count -= copyWithinKernel(&spliceData, inputFileDescriptor, outputFileDescriptor, count);
+#endif
+    copyViaBuffer(inputFileDescriptor, outputFileDescriptor, count, buffer, bufferSize);
+}
+
+#endif
+
+} // namespace IoUtilities
@@ -1,6 +1,7 @@
 #ifndef IOUTILITIES_COPY_H
 #define IOUTILITIES_COPY_H
 
+#include "../chrono/timespan.h"
 #include "../global.h"
 
 #include <iostream>
@@ -8,6 +9,30 @@
 
 namespace IoUtilities {
 
+/*!
+ * \brief The CopyStatistics struct holds statistics about a copy operation.
+ * \sa CopyHelper::asyncCopy()
+ */
+struct CPP_UTILITIES_EXPORT CopyStatistics
+{
+    CopyStatistics();
+    double throughput() const;
+
+    /// \brief The number of bytes copied (less than requested if the operation has been aborted).
+    uint64 bytesCopied;
+    /// \brief The duration of the whole operation.
+    ChronoUtilities::TimeSpan duration;
+    /// \brief The time the reader waited for a free buffer (reading was faster than writing).
+    ChronoUtilities::TimeSpan readerWaitTime;
+    /// \brief The time the writer waited for a filled buffer (writing was faster than reading).
+    ChronoUtilities::TimeSpan writerWaitTime;
+};
+
+CPP_UTILITIES_EXPORT CopyStatistics copyAsynchronously(std::istream &input, std::ostream &output, std::size_t count, char *buffer, std::size_t bufferSize, std::size_t bufferCount, const std::function<bool (void)> &isAborted, const std::function<void (double)> &callback);
+#ifdef PLATFORM_UNIX
+CPP_UTILITIES_EXPORT void copyFileDescriptorData(int inputFileDescriptor, int outputFileDescriptor, std::size_t count, char *buffer, std::size_t bufferSize);
+#endif
+
 /*!
  * \class IoUtilities::CopyHelper
  * \brief The CopyHelper class helps to copy bytes from one stream to another.
@@ -20,6 +45,12 @@ public:
     CopyHelper();
     void copy(std::istream &input, std::ostream &output, std::size_t count);
     void callbackCopy(std::istream &input, std::ostream &output, std::size_t count, const std::function<bool (void)> &isAborted, const std::function<void (double)> &callback);
+    template<typename Checksum> void checksumCopy(std::istream &input, std::ostream &output, std::size_t count, Checksum &checksum);
+    CopyStatistics asyncCopy(std::istream &input, std::ostream &output, std::size_t count, const std::function<bool (void)> &isAborted, const std::function<void (double)> &callback, std::size_t bufferCount = 2);
+#ifdef PLATFORM_UNIX
+    void copy(int inputFileDescriptor, int outputFileDescriptor, std::size_t count);
+    void callbackCopy(int inputFileDescriptor, int outputFileDescriptor, std::size_t count, const std::function<bool (void)> &isAborted, const std::function<void (double)> &callback);
+#endif
     char *buffer();
 private:
     char m_buffer[bufferSize];
@@ -75,6 +106,101 @@ void CopyHelper<bufferSize>::callbackCopy(std::istream &input, std::ostream &out
     callback(1.0);
 }
 
+/*!
+ * \brief Copies \a count bytes from \a input to \a output updating the specified \a checksum with the copied data.
+ *
+ * This allows computing eg. the CRC-32 of the copied data without reading it again.
+ *
+ * \tparam Checksum Specifies the type of the checksum, eg. Crc32. It must provide update(const char *buffer, std::size_t length).
+ * \remarks Set an exception mask using std::ios::exceptions() to get
+ *          a std::ios_base::failure exception when an IO error occurs.
+ */
+template<std::size_t bufferSize>
+template<typename Checksum>
+void CopyHelper<bufferSize>::checksumCopy(std::istream &input, std::ostream &output, std::size_t count, Checksum &checksum)
+{
+    while(count > bufferSize) {
+        input.read(m_buffer, bufferSize);
+        checksum.update(m_buffer, bufferSize);
+        output.write(m_buffer, bufferSize);
+        count -= bufferSize;
+    }
+    input.read(m_buffer, count);
+    checksum.update(m_buffer, count);
+    output.write(m_buffer, count);
+}
+
+/*!
+ * \brief Copies \a count bytes from \a input to \a output reading and writing concurrently. The procedure might be aborted. Progress updates will be reported.
+ *
+ * In contrast to callbackCopy() the data is read by a separate thread. So reading the next block overlaps writing the
+ * current block. Besides the internal buffer additional \a bufferCount - 1 buffers of the same size are allocated. The
+ * input stream must not be used by other threads until the copying has been finished.
+ *
+ * Copying is aborted when \a isAborted returns true. The current progress is reported by calling the specified \a callback function.
+ * Both functions are invoked from the calling thread.
+ *
+ * \returns Returns statistics about the throughput and which side had to wait for the other.
+ * \remarks Set an exception mask using std::ios::exceptions() to get a std::ios_base::failure exception when an IO error occurs.
+ *          Errors when reading are propagated to the calling thread.
+ * \sa copyAsynchronously()
+ */
+template<std::size_t bufferSize>
+CopyStatistics CopyHelper<bufferSize>::asyncCopy(std::istream &input, std::ostream &output, std::size_t count, const std::function<bool (void)> &isAborted, const std::function<void (double)> &callback, std::size_t bufferCount)
+{
+    return copyAsynchronously(input, output, count, m_buffer, bufferSize, bufferCount, isAborted, callback);
+}
+
+#ifdef PLATFORM_UNIX
+
+/*!
+ * \brief Copies \a count bytes from \a inputFileDescriptor to \a outputFileDescriptor.
+ *
+ * The data is copied within the kernel if possible so it does not need to pass the internal buffer.
+ * Reading and writing starts at the current offsets of the file descriptors which are advanced accordingly.
+ *
+ * \remarks When the file descriptors belong to streams, the streams must be flushed before and the stream
+ *          positions must be synchronized with the file offsets.
+ * \throws Throws std::ios_base::failure when an IO error occurs or the end of the input is reached prematurely.
+ * \sa copyFileDescriptorData()
+ */
+template<std::size_t bufferSize>
+void CopyHelper<bufferSize>::copy(int inputFileDescriptor, int outputFileDescriptor, std::size_t count)
+{
+    copyFileDescriptorData(inputFileDescriptor, outputFileDescriptor, count, m_buffer, bufferSize);
+}
+
+/*!
+ * \brief Copies \a count bytes from \a inputFileDescriptor to \a outputFileDescriptor. The procedure might be aborted. Progress updates will be reported.
+ *
+ * Copying is aborted when \a isAborted returns true. The current progress is reported by calling the specified \a callback function.
+ * Since the data is copied within the kernel if possible, the callbacks are invoked after each MiB (or after each \a bufferSize
+ * bytes if the buffer size is greater).
+ *
+ * \remarks When the file descriptors belong to streams, the streams must be flushed before and the stream
+ *          positions must be synchronized with the file offsets.
+ * \throws Throws std::ios_base::failure when an IO error occurs or the end of the input is reached prematurely.
+ * \sa copyFileDescriptorData()
+ */
+template<std::size_t bufferSize>
+void CopyHelper<bufferSize>::callbackCopy(int inputFileDescriptor, int outputFileDescriptor, std::size_t count, const std::function<bool (void)> &isAborted, const std::function<void (double)> &callback)
+{
+    static const std::size_t chunkSize = bufferSize > 0x100000 ? bufferSize : 0x100000;
+    std::size_t totalBytes = count;
+    while(count > chunkSize) {
+        copyFileDescriptorData(inputFileDescriptor, outputFileDescriptor, chunkSize, m_buffer, bufferSize);
+        count -= chunkSize;
+        if(isAborted()) {
+            return;
+        }
+        callback(static_cast<double>(totalBytes - count) / totalBytes);
+    }
+    copyFileDescriptorData(inputFileDescriptor, outputFileDescriptor, count, m_buffer, bufferSize);
+    callback(1.0);
+}
+
+#endif
+
 /*!
  * \brief Returns the internal buffer.
  */
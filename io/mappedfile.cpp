@@ -0,0 +1,321 @@
+#include "./mappedfile.h"
+#include "./catchiofailure.h"
+
+#include <algorithm>
+#include <utility>
+
+#ifdef PLATFORM_UNIX
+# include <unistd.h>
+# include <fcntl.h>
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+#endif
+
+using namespace std;
+
+namespace IoUtilities {
+
+/*!
+ * \class IoUtilities::MappedFile
+ * \brief The MappedFile class provides read-only access to a file by mapping it into memory.
+ *
+ * Either the whole file can be mapped (map()) or only a window of it (mapWindow()). The latter
+ * allows processing files which are bigger than the address space one wants to reserve by
+ * moving the window over the file.
+ *
+ * The mapped data can be read via BufferReader or BitReader without copying it first:
+ * \code
+ * MappedFile file("/path/to/file", MappingHint::Sequential);
+ * BufferReader reader(file.data(), file.size());
+ * const auto magic = reader.readUInt32BE();
+ * \endcode
+ * Code which relies on the std::istream interface (eg. BinaryReader) can use MappedFileBuffer
+ * which avoids the additional buffering of a std::filebuf.
+ *
+ * \remarks
+ *  - The mapping is read-only. Hence any number of threads might read the mapped data concurrently as long
+ *    as each thread uses its own reader and the mapping is not altered (mapWindow(), unmap(), close()) meanwhile.
+ *  - Only supported under UNIX yet. Otherwise std::ios_base::failure is thrown when opening a file.
+ */
+
+/*!
+ * \brief Constructs a MappedFile without opening a file.
+ */
+MappedFile::MappedFile() :
+    m_fd(-1),
+    m_fileSize(0),
+    m_mapping(nullptr),
+    m_mappingSize(0),
+    m_data(nullptr),
+    m_size(0),
+    m_windowOffset(0)
+{}
+
+/*!
+ * \brief Opens the file with the specified \a path and maps it completely.
+ * \throws Throws std::ios_base::failure if the file can not be opened or mapped.
+ */
+MappedFile::MappedFile(const string &path, MappingHint hint) :
+    MappedFile()
+{
+    open(path);
+    map(hint);
+}
+
+/*!
+ * \brief Moves the specified \a other MappedFile.
+ */
+MappedFile::MappedFile(MappedFile &&other) :
+    m_fd(other.m_fd),
+    m_fileSize(other.m_fileSize),
+    m_mapping(other.m_mapping),
+    m_mappingSize(other.m_mappingSize),
+    m_data(other.m_data),
+    m_size(other.m_size),
+    m_windowOffset(other.m_windowOffset)
+{
+    other.m_fd = -1;
+    other.m_fileSize = 0;
+    other.m_mapping = nullptr;
+    other.m_mappingSize = 0;
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_windowOffset = 0;
+}
+
+/*!
+ * \brief Unmaps and closes the file.
+ */
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+/*!
+ * \brief Closes the current file and moves the specified \a other MappedFile.
+ */
+MappedFile &MappedFile::operator=(MappedFile &&other)
+{
+    if(this != &other) {
+        close();
+        swap(m_fd, other.m_fd);
+        swap(m_fileSize, other.m_fileSize);
+        swap(m_mapping, other.m_mapping);
+        swap(m_mappingSize, other.m_mappingSize);
+        swap(m_data, other.m_data);
+        swap(m_size, other.m_size);
+        swap(m_windowOffset, other.m_windowOffset);
+    }
+    return *this;
+}
+
+/*!
+ * \brief Opens the file with the specified \a path for reading.
+ * \remarks A previously opened file is closed. Nothing is mapped until map() or mapWindow() is called.
+ * \throws Throws std::ios_base::failure if the file can not be opened.
+ */
+void MappedFile::open(const string &path)
+{
+    close();
+#ifdef PLATFORM_UNIX
+    const int fd = ::open(path.data(), O_RDONLY | O_CLOEXEC);
+    if(fd == -1) {
+        throwIoFailure("open failed");
+    }
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) == -1) {
+        ::close(fd);
+        throwIoFailure("fstat failed");
+    }
+    m_fd = fd;
+    m_fileSize = static_cast<uint64>(fileStat.st_size);
+#else
+    throwIoFailure("mapping files is not supported under this platform");
+#endif
+}
+
+/*!
+ * \brief Maps the whole file.
+ * \throws Throws std::ios_base::failure if no file is opened or the mapping fails.
+ */
+void MappedFile::map(MappingHint hint)
+{
+    mapWindow(0, static_cast<size_t>(m_fileSize), hint);
+}
+
+/*!
+ * \brief Maps \a size bytes of the file starting at the specified \a offset.
+ *
+ * The previous mapping is released. The \a offset does not need to be aligned to the page size. If the
+ * window exceeds the end of the file it is truncated accordingly.
+ *
+ * \throws Throws std::ios_base::failure if no file is opened, \a offset exceeds the end of the file or the mapping fails.
+ */
+void MappedFile::mapWindow(uint64 offset, size_t size, MappingHint hint)
+{
+    if(!isOpen()) {
+        throwIoFailure("no file opened");
+    }
+    if(offset > m_fileSize) {
+        throwIoFailure("window offset exceeds end of file");
+    }
+    unmap();
+    size = static_cast<size_t>(min<uint64>(size, m_fileSize - offset));
+    m_windowOffset = offset;
+    if(!size) {
+        return;
+    }
+#ifdef PLATFORM_UNIX
+    const uint64 alignedOffset = offset - (offset % pageSize());
+    const size_t mappingSize = size + static_cast<size_t>(offset - alignedOffset);
+    void *const mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, m_fd, static_cast<off_t>(alignedOffset));
+    if(mapping == MAP_FAILED) {
+        throwIoFailure("mmap failed");
+    }
+    m_mapping = mapping;
+    m_mappingSize = mappingSize;
+    m_data = reinterpret_cast<const char *>(mapping) + (offset - alignedOffset);
+    m_size = size;
+    advise(hint);
+#else
+    VAR_UNUSED(hint)
+#endif
+}
+
+/*!
+ * \brief Informs the kernel about the expected access pattern of the current mapping.
+ */
+void MappedFile::advise(MappingHint hint)
+{
+#ifdef PLATFORM_UNIX
+    if(!m_mapping) {
+        return;
+    }
+    int advice;
+    switch(hint) {
+    case MappingHint::Sequential:
+        advice = POSIX_MADV_SEQUENTIAL;
+        break;
+    case MappingHint::Random:
+        advice = POSIX_MADV_RANDOM;
+        break;
+    case MappingHint::WillNeed:
+        advice = POSIX_MADV_WILLNEED;
+        break;
+    default:
+        advice = POSIX_MADV_NORMAL;
+    }
+    posix_madvise(m_mapping, m_mappingSize, advice); // failure is not critical
+#else
+    VAR_UNUSED(hint)
+#endif
+}
+
+/*!
+ * \brief Releases the current mapping.
+ * \remarks Pointers obtained via data() become invalid.
+ */
+void MappedFile::unmap()
+{
+#ifdef PLATFORM_UNIX
+    if(m_mapping) {
+        munmap(m_mapping, m_mappingSize);
+    }
+#endif
+    m_mapping = nullptr;
+    m_mappingSize = 0;
+    m_data = nullptr;
+    m_size = 0;
+}
+
+/*!
+ * \brief Releases the current mapping and closes the file.
+ */
+void MappedFile::close()
+{
+    unmap();
+#ifdef PLATFORM_UNIX
+    if(m_fd != -1) {
+        ::close(m_fd);
+    }
+#endif
+    m_fd = -1;
+    m_fileSize = 0;
+    m_windowOffset = 0;
+}
+
+/*!
+ * \brief Returns the page size. Windows created via mapWindow() are internally aligned to it.
+ */
+size_t MappedFile::pageSize()
+{
+#ifdef PLATFORM_UNIX
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+#else
+    return 4096;
+#endif
+}
+
+/*!
+ * \class IoUtilities::MappedFileBuffer
+ * \brief The MappedFileBuffer class provides a read-only std::streambuf for the data mapped by a MappedFile.
+ *
+ * This allows using std::istream based code such as BinaryReader with mapped files. In contrast to a
+ * std::filebuf no intermediate buffer needs to be filled.
+ *
+ * \remarks Refers to the window which is mapped when constructing the buffer. The buffer must not be used
+ *          after the mapping has been altered.
+ */
+
+/*!
+ * \brief Constructs a buffer for the data currently mapped by the specified \a file.
+ */
+MappedFileBuffer::MappedFileBuffer(const MappedFile &file) :
+    MappedFileBuffer(file.data(), file.size())
+{}
+
+/*!
+ * \brief Constructs a buffer for the specified \a buffer.
+ * \remarks Does not take ownership over the specified \a buffer.
+ */
+MappedFileBuffer::MappedFileBuffer(const char *buffer, size_t bufferSize)
+{
+    char *const begin = const_cast<char *>(buffer);
+    setg(begin, begin, begin + bufferSize);
+}
+
+/// \cond
+
+MappedFileBuffer::pos_type MappedFileBuffer::seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which)
+{
+    if(!(which & ios_base::in)) {
+        return pos_type(off_type(-1));
+    }
+    char *base;
+    switch(dir) {
+    case ios_base::beg:
+        base = eback();
+        break;
+    case ios_base::cur:
+        base = gptr();
+        break;
+    default:
+        base = egptr();
+    }
+    if(off < eback() - base || off > egptr() - base) {
+        return pos_type(off_type(-1));
+    }
+    setg(eback(), base + off, egptr());
+    return pos_type(gptr() - eback());
+}
+
+MappedFileBuffer::pos_type MappedFileBuffer::seekpos(pos_type pos, ios_base::openmode which)
+{
+    return seekoff(off_type(pos), ios_base::beg, which);
+}
+
+/// \endcond
+
+} // namespace IoUtilities
@@ -0,0 +1,130 @@
+#ifndef IOUTILITIES_MAPPEDFILE_H
+#define IOUTILITIES_MAPPEDFILE_H
+
+#include "../conversion/types.h"
+#include "../global.h"
+
+#include <string>
+#include <streambuf>
+
+namespace IoUtilities {
+
+/*!
+ * \brief Specifies the expected access pattern for a mapping created by MappedFile.
+ * \remarks The hint is passed to the kernel (posix_madvise()) and only affects performance.
+ */
+enum class MappingHint
+{
+    Normal, /**< no special treatment */
+    Sequential, /**< pages are accessed in sequential order; aggressive read-ahead */
+    Random, /**< pages are accessed in random order; read-ahead is disabled */
+    WillNeed /**< the whole mapping will be accessed soon; pages are read in ahead */
+};
+
+class CPP_UTILITIES_EXPORT MappedFile
+{
+public:
+    MappedFile();
+    MappedFile(const std::string &path, MappingHint hint = MappingHint::Normal);
+    MappedFile(const MappedFile &other) = delete;
+    MappedFile(MappedFile &&other);
+    ~MappedFile();
+    MappedFile &operator=(const MappedFile &other) = delete;
+    MappedFile &operator=(MappedFile &&other);
+
+    void open(const std::string &path);
+    void map(MappingHint hint = MappingHint::Normal);
+    void mapWindow(uint64 offset, std::size_t size, MappingHint hint = MappingHint::Normal);
+    void advise(MappingHint hint);
+    void unmap();
+    void close();
+    bool isOpen() const;
+    bool isMapped() const;
+    uint64 fileSize() const;
+    const char *data() const;
+    const char *end() const;
+    std::size_t size() const;
+    uint64 windowOffset() const;
+    static std::size_t pageSize();
+
+private:
+    int m_fd;
+    uint64 m_fileSize;
+    void *m_mapping;
+    std::size_t m_mappingSize;
+    const char *m_data;
+    std::size_t m_size;
+    uint64 m_windowOffset;
+};
+
+/*!
+ * \brief Returns whether a file has been opened.
+ */
+inline bool MappedFile::isOpen() const
+{
+    return m_fd != -1;
+}
+
+/*!
+ * \brief Returns whether (a window of) the file is currently mapped.
+ */
+inline bool MappedFile::isMapped() const
+{
+    return m_mapping != nullptr;
+}
+
+/*!
+ * \brief Returns the size of the opened file.
+ */
+inline uint64 MappedFile::fileSize() const
+{
+    return m_fileSize;
+}
+
+/*!
+ * \brief Returns the start of the mapped data or nullptr if nothing is mapped.
+ * \remarks The returned pointer corresponds to the file offset returned by windowOffset().
+ */
+inline const char *MappedFile::data() const
+{
+    return m_data;
+}
+
+/*!
+ * \brief Returns the end of the mapped data.
+ */
+inline const char *MappedFile::end() const
+{
+    return m_data + m_size;
+}
+
+/*!
+ * \brief Returns the number of mapped bytes (starting at data()).
+ */
+inline std::size_t MappedFile::size() const
+{
+    return m_size;
+}
+
+/*!
+ * \brief Returns the file offset of the first mapped byte.
+ */
+inline uint64 MappedFile::windowOffset() const
+{
+    return m_windowOffset;
+}
+
+class CPP_UTILITIES_EXPORT MappedFileBuffer : public std::streambuf
+{
+public:
+    MappedFileBuffer(const MappedFile &file);
+    MappedFileBuffer(const char *buffer, std::size_t bufferSize);
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in);
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in);
+};
+
+} // namespace IoUtilities
+
+#endif // IOUTILITIES_MAPPEDFILE_H
@@ -13,6 +13,23 @@ CPP_UTILITIES_EXPORT uint64 powerModulo(uint64 base, uint64 expontent, uint64 mo
 CPP_UTILITIES_EXPORT int64 inverseModulo(int64 number, int64 module);
 CPP_UTILITIES_EXPORT uint64 orderModulo(uint64 number, uint64 module);
 
+/*!
+ * \brief Returns the number of leading zero bits of the specified \a value (64 if \a value is zero).
+ * \remarks Uses the corresponding instruction if supported by the compiler/CPU.
+ */
+inline byte countLeadingZeros(uint64 value)
+{
+#ifdef __GNUC__
+    return value ? static_cast<byte>(__builtin_clzll(value)) : 64;
+#else
+    byte count = 0;
+    for(uint64 mask = 0x8000000000000000ul; mask && !(value & mask); mask >>= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
 }
 
 #endif // MATHUTILITIES_H
@@ -0,0 +1,210 @@
+#include "./arena.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+/*!
+ * \namespace MemoryUtilities
+ * \brief Contains allocators for keeping many small objects in few large memory blocks.
+ */
+
+namespace MemoryUtilities {
+
+/*!
+ * \class MemoryUtilities::MonotonicArena
+ * \brief The MonotonicArena class hands out memory from large blocks by just advancing a pointer.
+ *
+ * Single allocations are never freed. Instead, all blocks are freed at once via release() or when the arena
+ * is destroyed. This is useful when many objects share the same lifetime, eg. all strings and buffers read while
+ * parsing a file:
+ * \code
+ * MonotonicArena arena;
+ * {
+ *     ArenaVector<ArenaString> names{ArenaAllocator<ArenaString>(arena)};
+ *     ArenaString name{ArenaAllocator<char>(arena)};
+ *     for(auto count = reader.readUInt32BE(); count; --count) {
+ *         reader.readLengthPrefixedString(name);
+ *         names.push_back(name);
+ *     }
+ *     // ...
+ * }
+ * arena.release(); // frees the memory of all names at once
+ * \endcode
+ *
+ * Requests which are larger than a quarter of the block size get a block of their own so the remaining space
+ * of the current block is not wasted.
+ *
+ * \remarks The class is not thread-safe.
+ */
+
+/// \cond
+
+struct MonotonicArena::Block
+{
+    Block *next;
+};
+
+/// \endcond
+
+/*!
+ * \brief Constructs a new arena allocating blocks of the specified \a blockSize (at least 256 bytes).
+ * \remarks No memory is allocated until the first call of allocate().
+ */
+MonotonicArena::MonotonicArena(size_t blockSize) :
+    m_blocks(nullptr),
+    m_pos(0),
+    m_end(0),
+    m_blockSize(max<size_t>(blockSize, 0x100)),
+    m_bytesAllocated(0),
+    m_bytesReserved(0)
+{}
+
+/*!
+ * \brief Destroys the arena freeing all memory allocated via the arena.
+ */
+MonotonicArena::~MonotonicArena()
+{
+    release();
+}
+
+/*!
+ * \brief Frees all memory allocated via the arena at once.
+ *
+ * Only the blocks are freed (usually a single one for thousands of allocations); the objects which have
+ * been allocated within the arena are not touched (and their destructors are not invoked).
+ */
+void MonotonicArena::release()
+{
+    for(Block *block = m_blocks, *next; block; block = next) {
+        next = block->next;
+        ::operator delete(block);
+    }
+    m_blocks = nullptr;
+    m_pos = m_end = 0;
+    m_bytesAllocated = m_bytesReserved = 0;
+}
+
+/*!
+ * \brief Allocates \a size bytes within a new block (the slow path of allocate()).
+ */
+void *MonotonicArena::allocateFromNewBlock(size_t size, size_t alignment)
+{
+    const size_t maxPayload = numeric_limits<size_t>::max() - sizeof(Block) - alignment;
+    if(size > maxPayload) {
+        throw bad_alloc();
+    }
+
+    // allocate a dedicated block for large requests and keep using the current block
+    const bool dedicated = size + alignment > m_blockSize / 4;
+    const size_t blockSize = dedicated ? sizeof(Block) + alignment + size : m_blockSize;
+    Block *const block = static_cast<Block *>(::operator new(blockSize));
+    m_bytesReserved += blockSize;
+    if(dedicated && m_blocks) {
+        block->next = m_blocks->next;
+        m_blocks->next = block;
+    } else {
+        block->next = m_blocks;
+        m_blocks = block;
+    }
+
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(block + 1);
+    const uintptr_t aligned = (begin + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+    if(!dedicated) {
+        m_pos = aligned + size;
+        m_end = reinterpret_cast<uintptr_t>(block) + blockSize;
+    }
+    m_bytesAllocated += size;
+    return reinterpret_cast<void *>(aligned);
+}
+
+/*!
+ * \class MemoryUtilities::ArenaAllocator
+ * \brief The ArenaAllocator class allows using a MonotonicArena with standard containers.
+ *
+ * Deallocating is a no-op so growing containers leave their old buffers behind until the arena is released.
+ * Reserving the required capacity up front avoids that.
+ *
+ * \sa ArenaString, ArenaVector
+ */
+
+/*!
+ * \class MemoryUtilities::FixedSizePool
+ * \brief The FixedSizePool class hands out blocks of a fixed size which can be returned individually.
+ *
+ * In contrast to MonotonicArena, blocks can be returned via deallocate() to be reused by subsequent allocations.
+ * Free blocks are kept in a singly linked list stored within the blocks themselves so allocating and deallocating
+ * is O(1) and there is no per-block overhead. The blocks are carved out of chunks holding a number of blocks each.
+ * All chunks are freed at once via release() or when the pool is destroyed.
+ *
+ * \remarks The class is not thread-safe.
+ */
+
+/// \cond
+
+struct FixedSizePool::Chunk
+{
+    Chunk *next;
+    max_align_t padding;
+};
+
+/// \endcond
+
+/*!
+ * \brief Constructs a new pool for blocks of at least \a blockSize bytes.
+ * \param blockSize Specifies the requested size of the blocks. It is rounded up to the maximum fundamental alignment.
+ * \param blocksPerChunk Specifies the number of blocks to allocate at once (at least one).
+ * \remarks No memory is allocated until the first call of allocate().
+ */
+FixedSizePool::FixedSizePool(size_t blockSize, size_t blocksPerChunk) :
+    m_freeBlocks(nullptr),
+    m_chunks(nullptr),
+    m_blockSize((max(blockSize, sizeof(FreeBlock)) + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1)),
+    m_blocksPerChunk(max<size_t>(blocksPerChunk, 1))
+{}
+
+/*!
+ * \brief Destroys the pool freeing all blocks.
+ */
+FixedSizePool::~FixedSizePool()
+{
+    release();
+}
+
+/*!
+ * \brief Frees all blocks at once (no matter whether they have been returned via deallocate()).
+ */
+void FixedSizePool::release()
+{
+    for(Chunk *chunk = m_chunks, *next; chunk; chunk = next) {
+        next = chunk->next;
+        ::operator delete(chunk);
+    }
+    m_chunks = nullptr;
+    m_freeBlocks = nullptr;
+}
+
+/*!
+ * \brief Allocates a new chunk and adds its blocks to the list of free blocks.
+ * \remarks The blocks are linked in ascending order so consecutive allocations are adjacent in memory.
+ */
+void FixedSizePool::refill()
+{
+    const size_t headerSize = offsetof(Chunk, padding);
+    if(m_blocksPerChunk > (numeric_limits<size_t>::max() - headerSize) / m_blockSize) {
+        throw bad_alloc();
+    }
+    Chunk *const chunk = static_cast<Chunk *>(::operator new(headerSize + m_blocksPerChunk * m_blockSize));
+    chunk->next = m_chunks;
+    m_chunks = chunk;
+
+    char *const blocks = reinterpret_cast<char *>(chunk) + headerSize;
+    for(size_t i = m_blocksPerChunk; i; --i) {
+        FreeBlock *const block = reinterpret_cast<FreeBlock *>(blocks + (i - 1) * m_blockSize);
+        block->next = m_freeBlocks;
+        m_freeBlocks = block;
+    }
+}
+
+} // namespace MemoryUtilities
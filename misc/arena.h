@@ -0,0 +1,252 @@
+#ifndef MEMORYUTILITIES_ARENA_H
+#define MEMORYUTILITIES_ARENA_H
+
+#include "../global.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MemoryUtilities {
+
+class CPP_UTILITIES_EXPORT MonotonicArena
+{
+public:
+    explicit MonotonicArena(std::size_t blockSize = 0x4000);
+    MonotonicArena(const MonotonicArena &other) = delete;
+    ~MonotonicArena();
+    MonotonicArena &operator=(const MonotonicArena &other) = delete;
+
+    void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+    template<typename T, typename... Args> T *create(Args &&... args);
+    void release();
+    std::size_t bytesAllocated() const;
+    std::size_t bytesReserved() const;
+
+private:
+    struct Block;
+    void *allocateFromNewBlock(std::size_t size, std::size_t alignment);
+
+    Block *m_blocks;
+    std::uintptr_t m_pos;
+    std::uintptr_t m_end;
+    std::size_t m_blockSize;
+    std::size_t m_bytesAllocated;
+    std::size_t m_bytesReserved;
+};
+
+/*!
+ * \brief Allocates \a size bytes aligned to the specified \a alignment (which must be a power of two).
+ *
+ * The memory is taken from the current block by just advancing a pointer. A new block is only allocated
+ * if the current block is exhausted.
+ *
+ * \remarks The memory stays valid until release() is called or the arena is destroyed.
+ * \throws Throws std::bad_alloc if a new block can not be allocated.
+ */
+inline void *MonotonicArena::allocate(std::size_t size, std::size_t alignment)
+{
+    const std::uintptr_t aligned = (m_pos + (alignment - 1)) & ~static_cast<std::uintptr_t>(alignment - 1);
+    if(m_pos && aligned <= m_end && size <= m_end - aligned) {
+        m_pos = aligned + size;
+        m_bytesAllocated += size;
+        return reinterpret_cast<void *>(aligned);
+    }
+    return allocateFromNewBlock(size, alignment);
+}
+
+/*!
+ * \brief Constructs a new object of type \a T within the arena passing the specified \a args to its constructor.
+ * \remarks The destructor of the object is never called so \a T must be trivially destructible.
+ * \throws Throws std::bad_alloc if a new block can not be allocated.
+ */
+template<typename T, typename... Args>
+T *MonotonicArena::create(Args &&... args)
+{
+    static_assert(std::is_trivially_destructible<T>::value, "objects within the arena are never destroyed");
+    return new(allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Returns the number of bytes handed out since the arena has been constructed or released (excluding padding).
+ */
+inline std::size_t MonotonicArena::bytesAllocated() const
+{
+    return m_bytesAllocated;
+}
+
+/*!
+ * \brief Returns the total size of the blocks currently owned by the arena.
+ */
+inline std::size_t MonotonicArena::bytesReserved() const
+{
+    return m_bytesReserved;
+}
+
+template<typename T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+
+    ArenaAllocator(MonotonicArena &arena);
+    template<typename U> ArenaAllocator(const ArenaAllocator<U> &other);
+
+    T *allocate(std::size_t n);
+    void deallocate(T *p, std::size_t n);
+    MonotonicArena &arena() const;
+
+private:
+    template<typename U> friend class ArenaAllocator;
+    MonotonicArena *m_arena;
+};
+
+/*!
+ * \brief Constructs an allocator taking the memory from the specified \a arena.
+ * \remarks The \a arena must outlive the allocator and all containers using it.
+ */
+template<typename T>
+inline ArenaAllocator<T>::ArenaAllocator(MonotonicArena &arena) :
+    m_arena(&arena)
+{}
+
+/*!
+ * \brief Constructs an allocator for \a T using the same arena as \a other.
+ */
+template<typename T>
+template<typename U>
+inline ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U> &other) :
+    m_arena(other.m_arena)
+{}
+
+/*!
+ * \brief Allocates memory for \a n objects of type \a T within the arena.
+ * \throws Throws std::bad_alloc if a new block can not be allocated.
+ */
+template<typename T>
+inline T *ArenaAllocator<T>::allocate(std::size_t n)
+{
+    return static_cast<T *>(m_arena->allocate(n * sizeof(T), alignof(T)));
+}
+
+/*!
+ * \brief Does nothing; the memory is only freed when the arena is released or destroyed.
+ */
+template<typename T>
+inline void ArenaAllocator<T>::deallocate(T *p, std::size_t n)
+{
+    VAR_UNUSED(p)
+    VAR_UNUSED(n)
+}
+
+/*!
+ * \brief Returns the arena the memory is taken from.
+ */
+template<typename T>
+inline MonotonicArena &ArenaAllocator<T>::arena() const
+{
+    return *m_arena;
+}
+
+/*!
+ * \brief Returns whether memory allocated by \a lhs can be deallocated by \a rhs (and vice versa).
+ */
+template<typename T, typename U>
+inline bool operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs)
+{
+    return &lhs.arena() == &rhs.arena();
+}
+
+/*!
+ * \brief Returns whether memory allocated by \a lhs can not be deallocated by \a rhs (and vice versa).
+ */
+template<typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs)
+{
+    return &lhs.arena() != &rhs.arena();
+}
+
+/*!
+ * \brief A string which keeps its data within a MonotonicArena.
+ */
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char> > ArenaString;
+
+/*!
+ * \brief A vector which keeps its elements within a MonotonicArena.
+ */
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T> >;
+
+class CPP_UTILITIES_EXPORT FixedSizePool
+{
+public:
+    explicit FixedSizePool(std::size_t blockSize, std::size_t blocksPerChunk = 64);
+    FixedSizePool(const FixedSizePool &other) = delete;
+    ~FixedSizePool();
+    FixedSizePool &operator=(const FixedSizePool &other) = delete;
+
+    void *allocate();
+    void deallocate(void *block);
+    void release();
+    std::size_t blockSize() const;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+    struct Chunk;
+    void refill();
+
+    FreeBlock *m_freeBlocks;
+    Chunk *m_chunks;
+    std::size_t m_blockSize;
+    std::size_t m_blocksPerChunk;
+};
+
+/*!
+ * \brief Returns a block of blockSize() bytes.
+ *
+ * Blocks which have been returned via deallocate() are reused first (LIFO). A new chunk is only allocated
+ * if no free block is left.
+ *
+ * \throws Throws std::bad_alloc if a new chunk can not be allocated.
+ */
+inline void *FixedSizePool::allocate()
+{
+    if(!m_freeBlocks) {
+        refill();
+    }
+    FreeBlock *const block = m_freeBlocks;
+    m_freeBlocks = block->next;
+    return block;
+}
+
+/*!
+ * \brief Returns the specified \a block (which must have been obtained via allocate()) to the pool.
+ * \remarks Passing nullptr is allowed and does nothing.
+ */
+inline void FixedSizePool::deallocate(void *block)
+{
+    if(block) {
+        FreeBlock *const freeBlock = static_cast<FreeBlock *>(block);
+        freeBlock->next = m_freeBlocks;
+        m_freeBlocks = freeBlock;
+    }
+}
+
+/*!
+ * \brief Returns the size of the blocks (the requested size rounded up to the maximum fundamental alignment).
+ */
+inline std::size_t FixedSizePool::blockSize() const
+{
+    return m_blockSize;
+}
+
+} // namespace MemoryUtilities
+
+#endif // MEMORYUTILITIES_ARENA_H
@@ -1,12 +1,23 @@
 #include "../conversion/binaryconversion.h"
+#include "../conversion/binaryrecord.h"
+#include "../conversion/charsetconverter.h"
+#include "../conversion/endianspan.h"
 #include "../conversion/stringconversion.h"
+#include "../conversion/unicode.h"
+#include "../conversion/varint.h"
+#include "../conversion/conversionexception.h"
 #include "../tests/testutils.h"
 
 #include <cppunit/extensions/HelperMacros.h>
 #include <cppunit/TestFixture.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <random>
+#include <vector>
 #include <sstream>
+#include <thread>
 #include <functional>
 #include <initializer_list>
 
@@ -25,7 +36,13 @@ class ConversionTests : public TestFixture
     CPPUNIT_TEST(testEndianness);
     CPPUNIT_TEST(testBinaryConversions);
     CPPUNIT_TEST(testSwapOrderFunctions);
+    CPPUNIT_TEST(testBinaryRecords);
+    CPPUNIT_TEST(testEndianSpan);
+    CPPUNIT_TEST(testVarInts);
     CPPUNIT_TEST(testStringEncodingConversions);
+    CPPUNIT_TEST(testUnicodeTranscoders);
+    CPPUNIT_TEST(testConcurrentStringEncodingConversions);
+    CPPUNIT_TEST(testCharsetConverter);
     CPPUNIT_TEST(testStringConversions);
     CPPUNIT_TEST_SUITE_END();
 
@@ -38,7 +55,13 @@ public:
     void testEndianness();
     void testBinaryConversions();
     void testSwapOrderFunctions();
+    void testBinaryRecords();
+    void testEndianSpan();
+    void testVarInts();
     void testStringEncodingConversions();
+    void testUnicodeTranscoders();
+    void testConcurrentStringEncodingConversions();
+    void testCharsetConverter();
     void testStringConversions();
 
 private:
@@ -147,7 +170,37 @@ void ConversionTests::testBinaryConversions()
         TEST_LE_CONVERSION(toInt64);
         TEST_CUSTOM_CONVERSION(getBytes24, toUInt24, BE, 0, 0xFFFFFF);
         TEST_CUSTOM_CONVERSION(getBytes24, toUInt24, LE, 0, 0xFFFFFF);
+        TEST_CUSTOM_CONVERSION(getBytes40, toUInt40, BE, 0, 0xFFFFFFFFFF);
+        TEST_CUSTOM_CONVERSION(getBytes40, toUInt40, LE, 0, 0xFFFFFFFFFF);
+        TEST_CUSTOM_CONVERSION(getBytes56, toUInt56, BE, 0, 0xFFFFFFFFFFFFFF);
+        TEST_CUSTOM_CONVERSION(getBytes56, toUInt56, LE, 0, 0xFFFFFFFFFFFFFF);
     }
+
+    // test byte layout and sign extension of odd widths
+    const char bytes[] = "\x81\x02\x03\x04\x05\x06\x07\x08";
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0x810203), BE::toUInt24(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0x030281), LE::toUInt24(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int32>(0x810203) - 0x1000000, BE::toInt24(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int32>(0x030281), LE::toInt24(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0x8102030405), BE::toUInt40(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(0x8102030405) - 0x10000000000, BE::toInt40(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(0x0504030281), LE::toInt40(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0x81020304050607), BE::toUInt56(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(0x81020304050607) - 0x100000000000000, BE::toInt56(bytes));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(0x07060504030281), LE::toInt56(bytes));
+    char buffer[8] = {0};
+    BE::getBytes40(0xFF8102030405, buffer);
+    CPPUNIT_ASSERT_EQUAL(string(bytes, 5), string(buffer, 5));
+    CPPUNIT_ASSERT_EQUAL(static_cast<char>(0), buffer[5]);
+    LE::getBytes56(0xFF07060504030281, buffer);
+    CPPUNIT_ASSERT_EQUAL(string(bytes, 7), string(buffer, 7));
+    CPPUNIT_ASSERT_EQUAL(static_cast<char>(0), buffer[7]);
+    BE::getBytes(-1.5f, buffer);
+    CPPUNIT_ASSERT_EQUAL(string("\xBF\xC0\x00\x00", 4), string(buffer, 4));
+    CPPUNIT_ASSERT_EQUAL(-1.5f, BE::toFloat32(buffer));
+    LE::getBytes(0.25, buffer);
+    CPPUNIT_ASSERT_EQUAL(string("\x00\x00\x00\x00\x00\x00\xD0\x3F", 8), string(buffer, 8));
+    CPPUNIT_ASSERT_EQUAL(0.25, LE::toFloat64(buffer));
 }
 
 /*!
@@ -158,6 +211,267 @@ void ConversionTests::testSwapOrderFunctions()
     CPPUNIT_ASSERT(swapOrder(static_cast<uint16>(0x7825)) == 0x2578);
     CPPUNIT_ASSERT(swapOrder(static_cast<uint32>(0x12345678)) == 0x78563412);
     CPPUNIT_ASSERT(swapOrder(static_cast<uint64>(0x1122334455667788)) == 0x8877665544332211);
+    static_assert(swapOrder(static_cast<uint32>(0x12345678)) == 0x78563412, "swapOrder() is usable in constant expressions");
+
+    // test array versions with sizes which are not a multiple of the vector width
+    vector<uint16> values16;
+    vector<uint32> values32;
+    vector<uint64> values64;
+    for(uint16 i = 0; i < 77; ++i) {
+        values16.push_back(0x0102 * i);
+        values32.push_back(0x01020304u * i);
+        values64.push_back(0x0102030405060708u * i);
+    }
+    swapOrder(values16.data(), values16.size());
+    swapOrder(values32.data(), values32.size());
+    swapOrder(values64.data(), values64.size());
+    for(uint16 i = 0; i < 77; ++i) {
+        CPPUNIT_ASSERT_EQUAL(swapOrder(static_cast<uint16>(0x0102 * i)), values16[i]);
+        CPPUNIT_ASSERT_EQUAL(swapOrder(static_cast<uint32>(0x01020304u * i)), values32[i]);
+        CPPUNIT_ASSERT_EQUAL(swapOrder(static_cast<uint64>(0x0102030405060708u * i)), values64[i]);
+    }
+}
+
+/*!
+ * \brief Tests decoding and encoding records via BinaryRecord.
+ */
+void ConversionTests::testBinaryRecords()
+{
+    enum class Type : byte { Audio = 1, Video = 2 };
+    typedef BinaryRecord<BEField<uint32>, LEField<uint16>, BEField<int32, 3>, LEField<int64, 5>, BEField<Type>, LEField<float32>, BEField<uint64, 6> > Record;
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(25), Record::size);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), Record::fieldCount);
+
+    const char buffer[] = "\x12\x34\x56\x78" "\x01\x02" "\xFF\xFF\xFE" "\x05\x04\x03\x02\x01" "\x02" "\x00\x00\x90\x3F" "\x01\x02\x03\x04\x05\x06";
+    uint32 magic;
+    uint16 version;
+    int32 offset;
+    int64 position;
+    Type type;
+    float32 gain;
+    uint64 timestamp;
+    Record::decode(buffer, std::tie(magic, version, offset, position, type, gain, timestamp));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0x12345678), magic);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint16>(0x0201), version);
+    CPPUNIT_ASSERT_EQUAL(static_cast<int32>(-2), offset);
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(0x0102030405), position);
+    CPPUNIT_ASSERT(type == Type::Video);
+    CPPUNIT_ASSERT_EQUAL(1.125f, gain);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0x010203040506), timestamp);
+    CPPUNIT_ASSERT_EQUAL(static_cast<int32>(-2), Record::decodeField<2>(buffer));
+    CPPUNIT_ASSERT(Record::decode(buffer) == std::make_tuple(magic, version, offset, position, type, gain, timestamp));
+
+    char encoded[Record::size];
+    Record::encode(std::tie(magic, version, offset, position, type, gain, timestamp), encoded);
+    CPPUNIT_ASSERT_EQUAL(string(buffer, Record::size), string(encoded, Record::size));
+    position = -0x80000000ll;
+    Record::encode(std::tie(magic, version, offset, position, type, gain, timestamp), encoded);
+    CPPUNIT_ASSERT_EQUAL(string("\x00\x00\x00\x80\xFF", 5), string(encoded + 9, 5));
+    CPPUNIT_ASSERT_EQUAL(position, Record::decodeField<3>(encoded));
+}
+
+/*!
+ * \brief Tests accessing raw data via EndianSpan.
+ */
+void ConversionTests::testEndianSpan()
+{
+    // store sorted values unaligned
+    vector<char> buffer(1 + 77 * sizeof(uint64));
+    for(uint32 i = 0; i != 77; ++i) {
+        BE::getBytes(i * 1000u, buffer.data() + 1 + i * sizeof(uint32));
+    }
+    const BESpan<uint32> span(buffer.data() + 1, 77);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(77), span.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(77 * 4), span.byteSize());
+    CPPUNIT_ASSERT(!span.empty());
+    CPPUNIT_ASSERT(BESpan<uint32>().empty());
+    CPPUNIT_ASSERT_EQUAL(5000u, span[5]);
+    CPPUNIT_ASSERT_EQUAL(0u, span.front());
+    CPPUNIT_ASSERT_EQUAL(76000u, span.back());
+
+    // use iterators with standard algorithms
+    CPPUNIT_ASSERT_EQUAL(static_cast<ptrdiff_t>(77), span.end() - span.begin());
+    CPPUNIT_ASSERT_EQUAL(static_cast<ptrdiff_t>(77), distance(span.begin(), span.end()));
+    CPPUNIT_ASSERT_EQUAL(static_cast<ptrdiff_t>(43), lower_bound(span.begin(), span.end(), 42001u) - span.begin());
+    CPPUNIT_ASSERT_EQUAL(static_cast<ptrdiff_t>(43), upper_bound(span.begin(), span.end(), 42000u) - span.begin());
+    CPPUNIT_ASSERT(binary_search(span.begin(), span.end(), 76000u));
+    CPPUNIT_ASSERT(!binary_search(span.begin(), span.end(), 76001u));
+    auto i = span.begin();
+    CPPUNIT_ASSERT_EQUAL(0u, *i++);
+    CPPUNIT_ASSERT_EQUAL(1000u, *i);
+    CPPUNIT_ASSERT_EQUAL(3000u, *(i += 2));
+    CPPUNIT_ASSERT_EQUAL(2000u, *--i);
+    CPPUNIT_ASSERT_EQUAL(4000u, i[2]);
+    CPPUNIT_ASSERT_EQUAL(6000u, *(2 + i + 4 - 2));
+    CPPUNIT_ASSERT(i > span.begin() && i >= span.begin() && span.begin() < i && span.begin() <= span.begin() && i != span.begin());
+    vector<uint32> reversed(span.size());
+    reverse_copy(span.begin(), span.end(), reversed.begin());
+    CPPUNIT_ASSERT_EQUAL(76000u, reversed.front());
+    const auto sub = span.subspan(10, 3);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), sub.size());
+    CPPUNIT_ASSERT_EQUAL(12000u, sub.back());
+
+    // copy values at once (with sizes which are not a multiple of the vector width)
+    vector<uint32> copied(span.size());
+    span.copyTo(copied.data());
+    CPPUNIT_ASSERT(equal(span.begin(), span.end(), copied.begin()));
+    for(uint16 i = 0; i != 77; ++i) {
+        LE::getBytes(static_cast<uint16>(i * 0x0102), buffer.data() + 1 + i * sizeof(uint16));
+    }
+    vector<uint16> copied16(77);
+    LESpan<uint16>(buffer.data() + 1, 77).copyTo(copied16.data());
+    BESpan<uint16>(buffer.data() + 1, 0).copyTo(nullptr);
+    for(uint16 i = 0; i != 77; ++i) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint16>(i * 0x0102), copied16[i]);
+        BE::getBytes(i * -0.5, buffer.data() + 1 + i * sizeof(float64));
+    }
+    vector<float64> copied64(77);
+    const BESpan<float64> span64(buffer.data() + 1, 77);
+    span64.copyTo(copied64.data());
+    for(uint16 i = 0; i != 77; ++i) {
+        CPPUNIT_ASSERT_EQUAL(i * -0.5, copied64[i]);
+        CPPUNIT_ASSERT_EQUAL(i * -0.5, span64[i]);
+    }
+}
+
+/*!
+ * \brief Tests encoding and decoding LEB128, EBML VINTs and zig-zag encoded integers.
+ */
+void ConversionTests::testVarInts()
+{
+    // zig-zag encoding
+    static_assert(zigZagEncode(static_cast<int32>(-2)) == 3u, "zig-zag encoding at compile time");
+    CPPUNIT_ASSERT_EQUAL(0u, zigZagEncode(static_cast<int32>(0)));
+    CPPUNIT_ASSERT_EQUAL(1u, zigZagEncode(static_cast<int32>(-1)));
+    CPPUNIT_ASSERT_EQUAL(2u, zigZagEncode(static_cast<int32>(1)));
+    CPPUNIT_ASSERT_EQUAL(0xFFFFFFFEu, zigZagEncode(numeric_limits<int32>::max()));
+    CPPUNIT_ASSERT_EQUAL(0xFFFFFFFFu, zigZagEncode(numeric_limits<int32>::min()));
+    CPPUNIT_ASSERT_EQUAL(numeric_limits<int32>::min(), zigZagDecode(0xFFFFFFFFu));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(-1), zigZagEncode(numeric_limits<int64>::min()));
+    CPPUNIT_ASSERT_EQUAL(numeric_limits<int64>::max(), zigZagDecode(static_cast<uint64>(-2)));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-3), zigZagDecode(static_cast<uint64>(5)));
+
+    // LEB128 encoding
+    char buffer[16];
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), encodeULeb128(624485, buffer));
+    CPPUNIT_ASSERT_EQUAL(string("\xE5\x8E\x26", 3), string(buffer, 3));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), uLeb128Size(624485));
+    CPPUNIT_ASSERT_EQUAL(maxLeb128Size, encodeULeb128(numeric_limits<uint64>::max(), buffer));
+    CPPUNIT_ASSERT_EQUAL(string("\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01", 10), string(buffer, 10));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), encodeSLeb128(-123456, buffer));
+    CPPUNIT_ASSERT_EQUAL(string("\xC0\xBB\x78", 3), string(buffer, 3));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), encodeSLeb128(63, buffer));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), encodeSLeb128(64, buffer));
+    CPPUNIT_ASSERT_EQUAL(string("\xC0\x00", 2), string(buffer, 2));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), encodeSLeb128(-64, buffer));
+    CPPUNIT_ASSERT_EQUAL('\x40', buffer[0]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), encodeSLeb128(-65, buffer));
+    CPPUNIT_ASSERT_EQUAL(string("\xBF\x7F", 2), string(buffer, 2));
+    CPPUNIT_ASSERT_EQUAL(maxLeb128Size, encodeSLeb128(numeric_limits<int64>::min(), buffer));
+
+    // LEB128 decoding with and without the 8 bytes required by the branchless path
+    uint64 value = 0;
+    int64 signedValue = 0;
+    memcpy(buffer, "\xE5\x8E\x26\x00\x00\x00\x00\x00", 8);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), decodeULeb128(buffer, buffer + 8, value));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(624485), value);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), decodeULeb128(buffer, buffer + 3, value));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(624485), value);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), decodeULeb128(buffer, buffer + 2, value));
+    memcpy(buffer, "\xC0\xBB\x78\x00\x00\x00\x00\x00", 8);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), decodeSLeb128(buffer, buffer + 8, signedValue));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-123456), signedValue);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), decodeSLeb128(buffer, buffer + 3, signedValue));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-123456), signedValue);
+    encodeULeb128(numeric_limits<uint64>::max(), buffer);
+    CPPUNIT_ASSERT_EQUAL(maxLeb128Size, decodeULeb128(buffer, buffer + sizeof(buffer), value));
+    CPPUNIT_ASSERT_EQUAL(numeric_limits<uint64>::max(), value);
+    encodeSLeb128(numeric_limits<int64>::min(), buffer);
+    CPPUNIT_ASSERT_EQUAL(maxLeb128Size, decodeSLeb128(buffer, buffer + sizeof(buffer), signedValue));
+    CPPUNIT_ASSERT_EQUAL(numeric_limits<int64>::min(), signedValue);
+    memset(buffer, 0x80, sizeof(buffer));
+    CPPUNIT_ASSERT_THROW(decodeULeb128(buffer, buffer + sizeof(buffer), value), ConversionException);
+    CPPUNIT_ASSERT_THROW(decodeSLeb128(buffer, buffer + sizeof(buffer), signedValue), ConversionException);
+
+    // VINT encoding
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), encodeVInt(1, buffer));
+    CPPUNIT_ASSERT_EQUAL('\x81', buffer[0]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), encodeVInt(126, buffer));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), encodeVInt(127, buffer));
+    CPPUNIT_ASSERT_EQUAL(string("\x40\x7F", 2), string(buffer, 2));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), encodeVInt(500, buffer, 4));
+    CPPUNIT_ASSERT_EQUAL(string("\x10\x00\x01\xF4", 4), string(buffer, 4));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), encodeVInt(vIntUnknownSize, buffer));
+    CPPUNIT_ASSERT_EQUAL('\xFF', buffer[0]);
+    CPPUNIT_ASSERT_EQUAL(maxVIntSize, encodeVInt(vIntUnknownSize, buffer, maxVIntSize));
+    CPPUNIT_ASSERT_EQUAL(string("\x01\xFF\xFF\xFF\xFF\xFF\xFF\xFF", 8), string(buffer, 8));
+    CPPUNIT_ASSERT_EQUAL(maxVIntSize, encodeVInt(0xFFFFFFFFFFFFFEull, buffer));
+    CPPUNIT_ASSERT_THROW(encodeVInt(0xFFFFFFFFFFFFFFull, buffer), ConversionException);
+    CPPUNIT_ASSERT_THROW(encodeVInt(127, buffer, 1), ConversionException);
+    CPPUNIT_ASSERT_THROW(encodeVInt(1, buffer, 9), ConversionException);
+
+    // VINT decoding
+    memcpy(buffer, "\x10\x00\x01\xF4\xFF\x40\x7F\x01\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x00", 16);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), vIntLength(buffer[0]));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), decodeVInt(buffer, buffer + 16, value));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(500), value);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), decodeVInt(buffer + 4, buffer + 16, value));
+    CPPUNIT_ASSERT_EQUAL(vIntUnknownSize, value);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), decodeVInt(buffer + 5, buffer + 7, value));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(127), value);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), decodeVInt(buffer + 7, buffer + 15, value));
+    CPPUNIT_ASSERT_EQUAL(vIntUnknownSize, value);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), decodeVInt(buffer + 7, buffer + 14, value));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), decodeVInt(buffer, buffer, value));
+    CPPUNIT_ASSERT_THROW(decodeVInt(buffer + 15, buffer + 16, value), ConversionException);
+
+    // batch decoding of mostly small values (covering the SIMD path and the transition between the paths)
+    vector<uint64> values(1000);
+    vector<int64> signedValues(values.size());
+    for(size_t i = 0; i != values.size(); ++i) {
+        const int bits = i % 7 ? 6 : uniform_int_distribution<int>(7, 63)(m_randomEngine);
+        values[i] = uniform_int_distribution<uint64>(0, (static_cast<uint64>(1) << bits) - 1)(m_randomEngine);
+        signedValues[i] = static_cast<int64>(values[i]) - static_cast<int64>(values[i] / 2);
+        signedValues[i] = i % 2 ? signedValues[i] : -signedValues[i];
+    }
+    values[500] = numeric_limits<uint64>::max();
+    signedValues[500] = numeric_limits<int64>::min();
+    vector<char> encoded(values.size() * maxLeb128Size);
+    char *end = encoded.data();
+    for(uint64 v : values) {
+        end += encodeULeb128(v, end);
+    }
+    vector<uint64> decodedValues(values.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(end - encoded.data()), decodeULeb128(encoded.data(), end, decodedValues.data(), values.size()));
+    CPPUNIT_ASSERT(values == decodedValues);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), decodeULeb128(encoded.data(), end - 1, decodedValues.data(), values.size()));
+    end = encoded.data();
+    for(int64 v : signedValues) {
+        end += encodeSLeb128(v, end);
+    }
+    vector<int64> decodedSignedValues(values.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(end - encoded.data()), decodeSLeb128(encoded.data(), end, decodedSignedValues.data(), values.size()));
+    CPPUNIT_ASSERT(signedValues == decodedSignedValues);
+    for(uint64 &v : values) {
+        v &= 0x3FFFFFFFFFFFFFull;
+    }
+    values[500] = vIntUnknownSize;
+    values[501] = 0xFFFFFFFFFFFFFEull;
+    values[502] = 127;
+    end = encoded.data();
+    for(uint64 v : values) {
+        end += encodeVInt(v, end, v == vIntUnknownSize ? 3 : 0);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(end - encoded.data()), decodeVInt(encoded.data(), end, decodedValues.data(), values.size()));
+    CPPUNIT_ASSERT(values == decodedValues);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), decodeVInt(encoded.data(), end - 1, decodedValues.data(), values.size()));
+
+    // batch zig-zag decoding
+    for(size_t i = 0; i != values.size(); ++i) {
+        decodedValues[i] = zigZagEncode(signedValues[i]);
+    }
+    zigZagDecode(decodedValues.data(), decodedSignedValues.data(), values.size());
+    CPPUNIT_ASSERT(signedValues == decodedSignedValues);
 }
 
 /*!
@@ -221,6 +535,241 @@ void ConversionTests::testStringEncodingConversions()
     assertEqual("UTF-8 to UFT-16LE", reinterpret_cast<const byte *>(LE_STR_FOR_ENDIANNESS(utf16)), 10, convertUtf8ToUtf16LE(reinterpret_cast<const char *>(utf8String), 6));
     assertEqual("UTF-8 to UFT-16BE (simple)", reinterpret_cast<const byte *>(BE_STR_FOR_ENDIANNESS(simpleUtf16)), 8, convertUtf8ToUtf16BE(reinterpret_cast<const char *>(simpleString), 4));
     assertEqual("UTF-8 to UFT-16BE", reinterpret_cast<const byte *>(BE_STR_FOR_ENDIANNESS(utf16)), 10, convertUtf8ToUtf16BE(reinterpret_cast<const char *>(utf8String), 6));
+
+    // test caching of iconv descriptors by convertString()
+    resetConversionDescriptorCacheStatistics();
+    assertEqual("Latin-1 to UTF-8 (iconv)", utf8String, 6, convertString("ISO-8859-1", "UTF-8", reinterpret_cast<const char *>(latin1String), 5, 1.5f));
+    auto statistics = conversionDescriptorCacheStatistics();
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(1), statistics.hits + statistics.misses);
+    const uint64 misses = statistics.misses;
+    for(int i = 0; i != 2; ++i) {
+        assertEqual("Latin-1 to UTF-8 (iconv, cached)", utf8String, 6, convertString("ISO-8859-1", "UTF-8", reinterpret_cast<const char *>(latin1String), 5, 1.5f));
+    }
+    statistics = conversionDescriptorCacheStatistics();
+    CPPUNIT_ASSERT_EQUAL(misses, statistics.misses);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(3) - misses, statistics.hits);
+    // a failed conversion must not leave state behind which affects the next conversion using the same descriptor
+    CPPUNIT_ASSERT_THROW(convertString("UTF-8", "UTF-16LE", "\xC3\x28", 2), ConversionException);
+    assertEqual("UTF-8 to UTF-16LE (iconv, after error)", reinterpret_cast<const byte *>(LE_STR_FOR_ENDIANNESS(utf16)), 10, convertString("UTF-8", "UTF-16LE", reinterpret_cast<const char *>(utf8String), 6, 2.0f));
+    // using as many other conversions as the cache can hold evicts the least recently used descriptor
+    for(const char *toCharset : {"ISO-8859-15", "CP1252", "CP1251", "UTF-16LE", "UTF-16BE", "UTF-32LE", "UTF-32BE", "UTF-7"}) {
+        convertString("UTF-8", toCharset, reinterpret_cast<const char *>(simpleString), 4, 4.0f);
+    }
+    resetConversionDescriptorCacheStatistics();
+    convertString("ISO-8859-1", "UTF-8", reinterpret_cast<const char *>(latin1String), 5, 1.5f);
+    statistics = conversionDescriptorCacheStatistics();
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0), statistics.hits);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(1), statistics.misses);
+    // unknown character sets are reported as before and not cached
+    CPPUNIT_ASSERT_THROW(convertString("UTF-8", "NO-SUCH-CHARSET", "ABCD", 4), ConversionException);
+    CPPUNIT_ASSERT_THROW(convertString("UTF-8", "NO-SUCH-CHARSET", "ABCD", 4), ConversionException);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(3), conversionDescriptorCacheStatistics().misses);
+}
+
+/*!
+ * \brief Tests the built-in Unicode transcoders against iconv (via convertString()) and checks the error handling.
+ */
+void ConversionTests::testUnicodeTranscoders()
+{
+    // compare with iconv using random strings mixing ASCII runs (to hit the SIMD paths) with other characters
+    uniform_int_distribution<int> runLengthDist(0, 70);
+    uniform_int_distribution<uint32> planeDist(0, 5);
+    for(int iteration = 0; iteration != 50; ++iteration) {
+        u32string codePoints;
+        for(int run = 0; run != 20; ++run) {
+            for(int length = runLengthDist(m_randomEngine); length; --length) {
+                codePoints.push_back(uniform_int_distribution<uint32>(0x20, 0x7E)(m_randomEngine));
+            }
+            switch(planeDist(m_randomEngine)) {
+            case 0: codePoints.push_back(uniform_int_distribution<uint32>(0x80, 0xFF)(m_randomEngine)); break;
+            case 1: codePoints.push_back(uniform_int_distribution<uint32>(0x100, 0x7FF)(m_randomEngine)); break;
+            case 2: codePoints.push_back(uniform_int_distribution<uint32>(0x800, 0xD7FF)(m_randomEngine)); break;
+            case 3: codePoints.push_back(uniform_int_distribution<uint32>(0xE000, 0xFFFF)(m_randomEngine)); break;
+            case 4: codePoints.push_back(uniform_int_distribution<uint32>(0x10000, 0x10FFFF)(m_randomEngine)); break;
+            }
+        }
+        const auto utf8 = convertString(CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN ? "UTF-32LE" : "UTF-32BE", "UTF-8",
+                                        reinterpret_cast<const char *>(codePoints.data()), codePoints.size() * 4, 4.0f);
+        const auto utf16LE = convertString("UTF-8", "UTF-16LE", utf8.first.get(), utf8.second, 2.0f);
+        const auto utf16BE = convertString("UTF-8", "UTF-16BE", utf8.first.get(), utf8.second, 2.0f);
+        const string utf8String(utf8.first.get(), utf8.second);
+        const string utf16LEString(utf16LE.first.get(), utf16LE.second), utf16BEString(utf16BE.first.get(), utf16BE.second);
+        const auto nativeUtf16LE = convertUtf8ToUtf16LE(utf8.first.get(), utf8.second);
+        const auto nativeUtf16BE = convertUtf8ToUtf16BE(utf8.first.get(), utf8.second);
+        const auto nativeUtf8FromLE = convertUtf16LEToUtf8(utf16LE.first.get(), utf16LE.second);
+        const auto nativeUtf8FromBE = convertUtf16BEToUtf8(utf16BE.first.get(), utf16BE.second);
+        CPPUNIT_ASSERT(utf16LEString == string(nativeUtf16LE.first.get(), nativeUtf16LE.second));
+        CPPUNIT_ASSERT(utf16BEString == string(nativeUtf16BE.first.get(), nativeUtf16BE.second));
+        CPPUNIT_ASSERT(utf8String == string(nativeUtf8FromLE.first.get(), nativeUtf8FromLE.second));
+        CPPUNIT_ASSERT(utf8String == string(nativeUtf8FromBE.first.get(), nativeUtf8FromBE.second));
+        CPPUNIT_ASSERT_EQUAL(utf16LEString.size(), utf16LengthOfUtf8(utf8String.data(), utf8String.data() + utf8String.size()) * 2);
+        CPPUNIT_ASSERT_EQUAL(utf8String.size(), utf8LengthOfUtf16(utf16LEString.data(), utf16LEString.data() + utf16LEString.size(), Endianness::LittleEndian));
+        CPPUNIT_ASSERT_EQUAL(utf8String.size(), utf8LengthOfUtf16(utf16BEString.data(), utf16BEString.data() + utf16BEString.size(), Endianness::BigEndian));
+
+        // Latin-1 can only represent the first 256 code points
+        string latin1String;
+        for(const char32_t codePoint : codePoints) {
+            latin1String.push_back(static_cast<char>(codePoint & 0xFF));
+        }
+        const auto utf8FromLatin1 = convertString("ISO-8859-1", "UTF-8", latin1String.data(), latin1String.size(), 2.0f);
+        const auto nativeUtf8FromLatin1 = convertLatin1ToUtf8(latin1String.data(), latin1String.size());
+        const string utf8FromLatin1String(utf8FromLatin1.first.get(), utf8FromLatin1.second);
+        CPPUNIT_ASSERT(utf8FromLatin1String == string(nativeUtf8FromLatin1.first.get(), nativeUtf8FromLatin1.second));
+        const auto nativeLatin1 = convertUtf8ToLatin1(utf8FromLatin1String.data(), utf8FromLatin1String.size());
+        CPPUNIT_ASSERT(latin1String == string(nativeLatin1.first.get(), nativeLatin1.second));
+        CPPUNIT_ASSERT_EQUAL(utf8FromLatin1String.size(), utf8LengthOfLatin1(latin1String.data(), latin1String.data() + latin1String.size()));
+        CPPUNIT_ASSERT_EQUAL(latin1String.size(), latin1LengthOfUtf8(utf8FromLatin1String.data(), utf8FromLatin1String.data() + utf8FromLatin1String.size()));
+    }
+
+    // the output size is computed exactly for conversions between Unicode and Latin-1 so the size hint does not matter
+    const string cjk("\xE6\x99\xB4\xE5\xA4\xA9\xE6\x99\xB4\xE5\xA4\xA9", 12);
+    const auto cjkUtf16 = convertString("utf8", "UTF-16BE", cjk.data(), cjk.size(), 0.1f);
+    CPPUNIT_ASSERT_EQUAL(string("\x66\x74\x59\x29\x66\x74\x59\x29", 8), string(cjkUtf16.first.get(), cjkUtf16.second));
+    // other conversions still work if the size hint is much too small
+    const string cyrillic(1000, '\xCA');
+    const auto cyrillicUtf8 = convertString("CP1251", "UTF-8", cyrillic.data(), cyrillic.size(), 0.01f);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2000), cyrillicUtf8.second);
+    CPPUNIT_ASSERT_EQUAL(string("\xD0\x9A", 2), string(cyrillicUtf8.first.get() + 1998, 2));
+
+    // invalid sequences: overlong encodings, encoded surrogates, code points beyond U+10FFFF, stray continuation bytes
+    for(const char *invalidUtf8 : {"ab\xC0\x80", "ab\xE0\x80\x80", "ab\xED\xA0\x80", "ab\xF4\x90\x80\x80", "ab\xF5\x80\x80\x80", "ab\x80", "ab\xC3\x28"}) {
+        CPPUNIT_ASSERT_THROW(convertUtf8ToUtf16LE(invalidUtf8, strlen(invalidUtf8)), ConversionException);
+        CPPUNIT_ASSERT_THROW(convertUtf8ToLatin1(invalidUtf8, strlen(invalidUtf8)), ConversionException);
+        CPPUNIT_ASSERT_THROW(convertString("UTF-8", "UTF-16LE", invalidUtf8, strlen(invalidUtf8)), ConversionException);
+    }
+    CPPUNIT_ASSERT_THROW(convertUtf8ToLatin1("\xE2\x82\xAC", 3), ConversionException);
+    CPPUNIT_ASSERT_THROW(convertUtf16LEToUtf8("a\0\x00\xDC", 4), ConversionException);
+    CPPUNIT_ASSERT_THROW(convertUtf16LEToUtf8("\x00\xD8\x41\x00", 4), ConversionException);
+    CPPUNIT_ASSERT_THROW(convertUtf16BEToUtf8("\xDC\x00", 2), ConversionException);
+
+    // incomplete sequences at the end are ignored by the convert-functions and left over by the transcode-functions
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), convertUtf8ToUtf16LE("a\xE2\x82\xAC\xE2\x82", 6).second);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), convertUtf16LEToUtf8("a\0\x3D\xD8", 4).second);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), convertUtf16BEToUtf8("\0a\0", 3).second);
+    const char chunks[] = "\xF0\x9F\x98\x80";
+    char output[8];
+    const char *input = chunks;
+    char *outputEnd = transcodeUtf8ToUtf16(input, chunks + 2, output, Endianness::BigEndian);
+    CPPUNIT_ASSERT(input == chunks);
+    CPPUNIT_ASSERT(outputEnd == output);
+    outputEnd = transcodeUtf8ToUtf16(input, chunks + 4, output, Endianness::BigEndian);
+    CPPUNIT_ASSERT(input == chunks + 4);
+    CPPUNIT_ASSERT_EQUAL(string("\xD8\x3D\xDE\x00", 4), string(output, outputEnd));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), convertUtf8ToUtf16LE(nullptr, 0).second);
+}
+
+/*!
+ * \brief Tests whether the character set conversion functions can be used from multiple threads at the same time.
+ */
+void ConversionTests::testConcurrentStringEncodingConversions()
+{
+    const string utf8("Sigur R\xC3\xB3s - Hopp\xC3\xADpolla, \xD0\x9A\xD0\xB8\xD0\xBD\xD0\xBE, \xE6\x99\xB4\xE5\xA4\xA9 \xF0\x9F\x8E\xB5", 47);
+    const string latin1("Die \xC4rzte - Schrei nach Liebe (\xC9dition sp\xE9\x63iale)", 48);
+    const auto utf16LE = convertUtf8ToUtf16LE(utf8.data(), utf8.size());
+    const auto utf16BE = convertUtf8ToUtf16BE(utf8.data(), utf8.size());
+    const auto latin1AsUtf8 = convertLatin1ToUtf8(latin1.data(), latin1.size());
+    const string expectedUtf16LE(utf16LE.first.get(), utf16LE.second);
+    const string expectedUtf16BE(utf16BE.first.get(), utf16BE.second);
+    const string expectedLatin1AsUtf8(latin1AsUtf8.first.get(), latin1AsUtf8.second);
+
+    // let each thread convert back and forth and only check the results afterwards (CppUnit assertions are not thread-safe)
+    vector<size_t> failures(4);
+    vector<thread> threads;
+    for(size_t threadIndex = 0; threadIndex != failures.size(); ++threadIndex) {
+        threads.emplace_back([&, threadIndex] {
+            for(int iteration = 0; iteration != 500; ++iteration) {
+                const auto le = convertUtf8ToUtf16LE(utf8.data(), utf8.size());
+                const auto be = convertUtf8ToUtf16BE(utf8.data(), utf8.size());
+                const auto fromLE = convertUtf16LEToUtf8(le.first.get(), le.second);
+                const auto fromBE = convertUtf16BEToUtf8(be.first.get(), be.second);
+                const auto fromLatin1 = convertLatin1ToUtf8(latin1.data(), latin1.size());
+                const auto toLatin1 = convertUtf8ToLatin1(fromLatin1.first.get(), fromLatin1.second);
+                const auto viaIconv = convertString("ISO-8859-1", "UTF-8", latin1.data(), latin1.size(), 2.0f);
+                if(string(le.first.get(), le.second) != expectedUtf16LE
+                        || string(be.first.get(), be.second) != expectedUtf16BE
+                        || string(fromLE.first.get(), fromLE.second) != utf8
+                        || string(fromBE.first.get(), fromBE.second) != utf8
+                        || string(toLatin1.first.get(), toLatin1.second) != latin1
+                        || string(viaIconv.first.get(), viaIconv.second) != expectedLatin1AsUtf8) {
+                    ++failures[threadIndex];
+                }
+            }
+        });
+    }
+    for(auto &thread : threads) {
+        thread.join();
+    }
+    for(const size_t failuresOfThread : failures) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), failuresOfThread);
+    }
+}
+
+/*!
+ * \brief Tests the CharsetConverter class.
+ */
+void ConversionTests::testCharsetConverter()
+{
+    // convert chunks of all sizes so multibyte sequences are split at every possible position
+    const string utf8("Hopp\xC3\xADpolla \xD0\x9A\xD0\xB8\xD0\xBD\xD0\xBE \xE6\x99\xB4\xE5\xA4\xA9 \xF0\x9F\x8E\xB5!", 33);
+    const auto expected = convertString("UTF-8", "UTF-16BE", utf8.data(), utf8.size(), 2.0f);
+    const string expectedUtf16BE(expected.first.get(), expected.second);
+    CharsetConverter converter("UTF-8", "UTF-16BE");
+    for(size_t chunkSize = 1; chunkSize <= 8; ++chunkSize) {
+        stringstream output(ios_base::in | ios_base::out | ios_base::binary);
+        for(size_t offset = 0; offset < utf8.size(); offset += chunkSize) {
+            converter.convert(utf8.data() + offset, min(chunkSize, utf8.size() - offset), output);
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), converter.pendingInputSize());
+        converter.finish(output);
+        CPPUNIT_ASSERT_EQUAL(expectedUtf16BE, output.str());
+    }
+
+    // convert into a small output buffer which needs to be drained several times
+    string utf16BE;
+    char buffer[5];
+    const char *input = utf8.data();
+    for(const char *const inputEnd = input + utf8.size(); input != inputEnd; ) {
+        utf16BE.append(buffer, converter.convert(input, inputEnd, buffer, buffer + sizeof(buffer)));
+    }
+    utf16BE.append(buffer, converter.finish(buffer, buffer + sizeof(buffer)));
+    CPPUNIT_ASSERT_EQUAL(expectedUtf16BE, utf16BE);
+    input = "\xC3\xAD";
+    CPPUNIT_ASSERT_THROW(converter.convert(input, input + 2, buffer, buffer + 1), ConversionException);
+
+    // keep an incomplete sequence until the next chunk is passed
+    input = "A\xE6\x99";
+    CPPUNIT_ASSERT(converter.convert(input, input + 3, buffer, buffer + sizeof(buffer)) == buffer + 2);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), converter.pendingInputSize());
+    input = "\xB4";
+    CPPUNIT_ASSERT(converter.convert(input, input + 1, buffer, buffer + sizeof(buffer)) == buffer + 2);
+    CPPUNIT_ASSERT_EQUAL(string("\x66\x74", 2), string(buffer, 2));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), converter.pendingInputSize());
+    // ignore an incomplete sequence at the end (like convertString() does)
+    input = "\xE6";
+    converter.convert(input, input + 1, buffer, buffer + sizeof(buffer));
+    CPPUNIT_ASSERT(converter.finish(buffer, buffer + sizeof(buffer)) == buffer);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), converter.pendingInputSize());
+
+    // return the output converted so far before reporting an invalid sequence
+    input = "AB\xFF" "CD";
+    CPPUNIT_ASSERT(converter.convert(input, input + 5, buffer, buffer + sizeof(buffer)) == buffer + 4);
+    CPPUNIT_ASSERT_EQUAL(string("\0A\0B", 4), string(buffer, 4));
+    CPPUNIT_ASSERT_EQUAL('\xFF', *input);
+    CPPUNIT_ASSERT_THROW(converter.convert(input, input + 3, buffer, buffer + sizeof(buffer)), ConversionException);
+    converter.reset();
+    stringstream output(ios_base::in | ios_base::out | ios_base::binary);
+    CPPUNIT_ASSERT_THROW(converter.convert("AB\xFF" "CD", 5, output), ConversionException);
+    CPPUNIT_ASSERT_EQUAL(string("\0A\0B", 4), output.str());
+
+    // write the sequence to return to the initial state when finishing a stateful encoding
+    CharsetConverter utf7Converter("UTF-8", "UTF-7");
+    output.str(string());
+    utf7Converter.convert("\xC3\xA4", 1, output);
+    utf7Converter.convert("\xA4", 1, output);
+    utf7Converter.finish(output);
+    CPPUNIT_ASSERT_EQUAL(string("+AOQ-"), output.str());
+
+    CPPUNIT_ASSERT_THROW(CharsetConverter("UTF-8", "NO-SUCH-CHARSET"), ConversionException);
 }
 
 /*!
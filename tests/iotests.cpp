@@ -2,11 +2,17 @@
 
 #include "../io/binaryreader.h"
 #include "../io/binarywriter.h"
+#include "../io/bufferreader.h"
 #include "../io/bitreader.h"
+#include "../io/bitwriter.h"
 #include "../io/path.h"
 #include "../io/inifile.h"
+#include "../io/mappedfile.h"
 #include "../io/copy.h"
 #include "../io/catchiofailure.h"
+#include "../io/checksum.h"
+
+#include "../misc/arena.h"
 
 #include <cppunit/extensions/HelperMacros.h>
 #include <cppunit/TestFixture.h>
@@ -15,11 +21,68 @@
 #include <sstream>
 #include <algorithm>
 
+#ifdef PLATFORM_UNIX
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
 using namespace std;
 using namespace IoUtilities;
+using namespace ConversionUtilities;
+using namespace MemoryUtilities;
 
 using namespace CPPUNIT_NS;
 
+/// \cond
+
+namespace {
+
+/*!
+ * \brief The ChunkedStreamBuffer class provides the specified data in chunks of the specified size.
+ * \remarks Behaves like an unbuffered stream buffer if the chunk size is zero.
+ */
+class ChunkedStreamBuffer : public streambuf
+{
+public:
+    ChunkedStreamBuffer(const string &data, size_t chunkSize) :
+        m_data(data.begin(), data.end()),
+        m_chunkSize(chunkSize),
+        m_pos(0)
+    {}
+
+protected:
+    int_type underflow() override
+    {
+        if(m_pos >= m_data.size()) {
+            return traits_type::eof();
+        }
+        if(!m_chunkSize) {
+            return traits_type::to_int_type(m_data[m_pos]);
+        }
+        char *const begin = m_data.data() + m_pos;
+        m_pos += min(m_chunkSize, m_data.size() - m_pos);
+        setg(begin, begin, m_data.data() + m_pos);
+        return traits_type::to_int_type(*begin);
+    }
+
+    int_type uflow() override
+    {
+        if(m_chunkSize) {
+            return streambuf::uflow();
+        }
+        return m_pos < m_data.size() ? traits_type::to_int_type(m_data[m_pos++]) : traits_type::eof();
+    }
+
+private:
+    vector<char> m_data;
+    const size_t m_chunkSize;
+    size_t m_pos;
+};
+
+}
+
+/// \endcond
+
 /*!
  * \brief The IoTests class tests classes and methods of the IoUtilities namespace.
  */
@@ -29,10 +92,17 @@ class IoTests : public TestFixture
     CPPUNIT_TEST(testFailure);
     CPPUNIT_TEST(testBinaryReader);
     CPPUNIT_TEST(testBinaryWriter);
+    CPPUNIT_TEST(testBufferedBinaryWriter);
+    CPPUNIT_TEST(testBufferReader);
     CPPUNIT_TEST(testBitReader);
+    CPPUNIT_TEST(testBitWriter);
+    CPPUNIT_TEST(testMappedFile);
     CPPUNIT_TEST(testPathUtilities);
     CPPUNIT_TEST(testIniFile);
     CPPUNIT_TEST(testCopy);
+    CPPUNIT_TEST(testCrc32);
+    CPPUNIT_TEST(testChecksums);
+    CPPUNIT_TEST(testArena);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -42,10 +112,17 @@ public:
     void testFailure();
     void testBinaryReader();
     void testBinaryWriter();
+    void testBufferedBinaryWriter();
+    void testBufferReader();
     void testBitReader();
+    void testBitWriter();
+    void testMappedFile();
     void testPathUtilities();
     void testIniFile();
     void testCopy();
+    void testCrc32();
+    void testChecksums();
+    void testArena();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(IoTests);
@@ -126,6 +203,106 @@ void IoTests::testBinaryReader()
     CPPUNIT_ASSERT(reader.readString(3) == "abc");
     CPPUNIT_ASSERT(reader.readLengthPrefixedString() == "ABC");
     CPPUNIT_ASSERT(reader.readTerminatedString() == "def");
+
+    // test reading terminated strings chunk-wise (and byte-wise from an unbuffered stream buffer)
+    const string terminatedStrings("first\0second string\0third", 25);
+    for(const size_t chunkSize : {0u, 3u, 100u}) {
+        ChunkedStreamBuffer streamBuffer(terminatedStrings, chunkSize);
+        istream chunkedStream(&streamBuffer);
+        BinaryReader chunkedReader(&chunkedStream);
+        Crc32 crc;
+        chunkedReader.setChecksum(&crc);
+        CPPUNIT_ASSERT_EQUAL(string("first"), chunkedReader.readTerminatedString());
+        CPPUNIT_ASSERT_EQUAL(string("seco"), chunkedReader.readTerminatedString(static_cast<size_t>(4)));
+        CPPUNIT_ASSERT_EQUAL(string("nd string"), chunkedReader.readTerminatedString(static_cast<size_t>(100)));
+        CPPUNIT_ASSERT(chunkedStream.good());
+        CPPUNIT_ASSERT_EQUAL(string("third"), chunkedReader.readTerminatedString());
+        CPPUNIT_ASSERT(chunkedStream.fail());
+        CPPUNIT_ASSERT(chunkedStream.eof());
+        CPPUNIT_ASSERT_EQUAL(Crc32::compute(terminatedStrings.data(), terminatedStrings.size()), crc.value());
+    }
+
+    // test reading multibyte-terminated strings (terminations at odd offsets must be ignored and code units might
+    // be split between chunks)
+    string misalignedTerminations;
+    for(int i = 0; i != 50; ++i) {
+        misalignedTerminations.append("x\0\0y", 4);
+    }
+    const string multibyteTerminatedStrings = misalignedTerminations + string("\0\0a\0b\0cd\0\0\0e\0f", 14);
+    for(const size_t chunkSize : {0u, 3u, 100u}) {
+        ChunkedStreamBuffer streamBuffer(multibyteTerminatedStrings, chunkSize);
+        istream chunkedStream(&streamBuffer);
+        BinaryReader chunkedReader(&chunkedStream);
+        Crc32 crc;
+        chunkedReader.setChecksum(&crc);
+        CPPUNIT_ASSERT_EQUAL(misalignedTerminations, chunkedReader.readMultibyteTerminatedStringLE());
+        CPPUNIT_ASSERT_EQUAL(string("a\0b\0c", 5), chunkedReader.readMultibyteTerminatedStringBE(static_cast<size_t>(5)));
+        CPPUNIT_ASSERT_EQUAL(string("d\0", 2), chunkedReader.readMultibyteTerminatedStringBE(static_cast<size_t>(100)));
+        CPPUNIT_ASSERT(chunkedStream.good());
+        CPPUNIT_ASSERT_EQUAL(string("e\0f", 3), chunkedReader.readMultibyteTerminatedStringLE());
+        CPPUNIT_ASSERT(chunkedStream.fail());
+        CPPUNIT_ASSERT(chunkedStream.eof());
+        CPPUNIT_ASSERT_EQUAL(Crc32::compute(multibyteTerminatedStrings.data(), multibyteTerminatedStrings.size()), crc.value());
+    }
+
+    // test reading strings into a caller-provided string and skipping length prefixed strings
+    testFile.seekg(-11, ios_base::end);
+    string result;
+    result.reserve(0x100);
+    const char *const resultData = result.data();
+    reader.readString(result, 3);
+    CPPUNIT_ASSERT_EQUAL(string("abc"), result);
+    reader.readLengthPrefixedString(result);
+    CPPUNIT_ASSERT_EQUAL(string("ABC"), result);
+    reader.readTerminatedString(result);
+    CPPUNIT_ASSERT_EQUAL(string("def"), result);
+    CPPUNIT_ASSERT_EQUAL(resultData, result.data());
+    testFile.seekg(-8, ios_base::end);
+    reader.skipLengthPrefixedString();
+    reader.readTerminatedString(result, static_cast<size_t>(2));
+    CPPUNIT_ASSERT_EQUAL(string("de"), result);
+    ChunkedStreamBuffer streamBuffer(multibyteTerminatedStrings, 3);
+    istream chunkedStream(&streamBuffer);
+    BinaryReader chunkedReader(&chunkedStream);
+    chunkedReader.readMultibyteTerminatedStringLE(result);
+    CPPUNIT_ASSERT_EQUAL(misalignedTerminations, result);
+    chunkedReader.readMultibyteTerminatedStringBE(result, static_cast<size_t>(5));
+    CPPUNIT_ASSERT_EQUAL(string("a\0b\0c", 5), result);
+
+    // test reading arrays
+    testFile.seekg(0);
+    uint16 uint16Values[2];
+    reader.readUInt16LE(uint16Values, 2);
+    CPPUNIT_ASSERT(uint16Values[0] == 0x0102u);
+    CPPUNIT_ASSERT(uint16Values[1] == 0x0201u);
+    stringstream arrayStream(ios_base::in | ios_base::out | ios_base::binary);
+    arrayStream.exceptions(ios_base::failbit | ios_base::badbit);
+    char buffer[8];
+    for(uint32 i = 0; i < 45; ++i) {
+        ConversionUtilities::BE::getBytes(i * 0x01020304u, buffer);
+        arrayStream.write(buffer, 4);
+        ConversionUtilities::LE::getBytes(static_cast<float64>(i) * 1.5, buffer);
+        arrayStream.write(buffer, 8);
+    }
+    reader.setStream(&arrayStream);
+    uint32 uint32Values[45];
+    float64 float64Values[45];
+    for(uint32 i = 0; i < 45; ++i) {
+        reader.readUInt32BE(uint32Values + i, 1);
+        reader.readFloat64LE(float64Values + i, 1);
+        CPPUNIT_ASSERT(uint32Values[i] == i * 0x01020304u);
+        CPPUNIT_ASSERT(float64Values[i] == static_cast<float64>(i) * 1.5);
+    }
+    arrayStream.seekg(0);
+    arrayStream.str(string());
+    for(uint32 i = 0; i < 45; ++i) {
+        ConversionUtilities::BE::getBytes(i * 0x01020304u, buffer);
+        arrayStream.write(buffer, 4);
+    }
+    reader.readInt32BE(reinterpret_cast<int32 *>(uint32Values), 45);
+    for(uint32 i = 0; i < 45; ++i) {
+        CPPUNIT_ASSERT(uint32Values[i] == i * 0x01020304u);
+    }
 }
 
 /*!
@@ -196,6 +373,300 @@ void IoTests::testBinaryWriter()
     for(char c : testData) {
         CPPUNIT_ASSERT(c == static_cast<char>(testFile.get()));
     }
+
+    // test writing arrays (exceeding the size of the staging buffer)
+    vector<uint32> uint32Values;
+    vector<float64> float64Values;
+    for(uint32 i = 0; i < 5000; ++i) {
+        uint32Values.push_back(i * 0x01020304u);
+        float64Values.push_back(static_cast<float64>(i) * 0.5);
+    }
+    stringstream expectedStream(ios_base::in | ios_base::out | ios_base::binary), actualStream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&expectedStream);
+    for(uint32 value : uint32Values) {
+        writer.writeUInt32BE(value);
+    }
+    for(float64 value : float64Values) {
+        writer.writeFloat64LE(value);
+    }
+    writer.setStream(&actualStream);
+    writer.writeUInt32BE(uint32Values.data(), uint32Values.size());
+    writer.writeFloat64LE(float64Values.data(), float64Values.size());
+    CPPUNIT_ASSERT(expectedStream.str() == actualStream.str());
+
+    // test writing and reading a record consisting of the fields written before
+    typedef BinaryRecord<LEField<int16>, BEField<int16>, LEField<int32, 3>, BEField<int32, 3>, LEField<int32>, BEField<int32>,
+            LEField<int64, 5>, BEField<int64, 5>, LEField<int64, 7>, BEField<int64, 7>, LEField<int64>, BEField<int64>,
+            LEField<float32>, LEField<float64>, BEField<float32>, BEField<float64>, BEField<bool>, BEField<bool> > Record;
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(84), Record::size);
+    const Record::ValueTuple values(0x0102, 0x0102, 0x010203, 0x010203, 0x01020304, 0x01020304, 0x0102030405, 0x0102030405,
+                                    0x01020304050607, 0x01020304050607, 0x0102030405060708, 0x0102030405060708,
+                                    1.125f, 1.625, 1.125f, 1.625, false, true);
+    stringstream recordStream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&recordStream);
+    writer.writeRecord<Record>(values);
+    char expectedRecord[Record::size];
+    testFile.seekg(0);
+    testFile.read(expectedRecord, Record::size);
+    CPPUNIT_ASSERT(string(expectedRecord, Record::size) == recordStream.str());
+    BinaryReader reader(&recordStream);
+    CPPUNIT_ASSERT(reader.readRecord<Record>() == values);
+    CPPUNIT_ASSERT(!reader.fail());
+
+    // test reading a record from a stream which is too short; missing bytes are read as zero
+    typedef BinaryRecord<BEField<uint16>, BEField<uint32> > ShortRecord;
+    stringstream shortRecordStream(string("\x01\x02\x03", 3), ios_base::in | ios_base::binary);
+    reader.setStream(&shortRecordStream);
+    CPPUNIT_ASSERT(reader.readRecord<ShortRecord>() == ShortRecord::ValueTuple(0x0102, 0x03000000));
+    CPPUNIT_ASSERT(reader.fail());
+    CPPUNIT_ASSERT(reader.eof());
+
+    // test writing and reading variable-length integers
+    stringstream varIntStream(ios_base::in | ios_base::out | ios_base::binary);
+    writer.setStream(&varIntStream);
+    writer.writeULeb128(624485);
+    writer.writeSLeb128(-123456);
+    writer.writeZigZagLeb128(-2);
+    writer.writeVInt(500, 4);
+    writer.writeVInt(vIntUnknownSize);
+    const uint64 varInts[] = {1, 2, 300, 4, 0xFFFFFFFFFFull};
+    writer.writeULeb128(varInts, 5);
+    CPPUNIT_ASSERT_EQUAL(string("\xE5\x8E\x26\xC0\xBB\x78\x03\x10\x00\x01\xF4\xFF\x01\x02\xAC\x02\x04\xFF\xFF\xFF\xFF\xFF\x1F", 23), varIntStream.str());
+    reader.setStream(&varIntStream);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(624485), reader.readULeb128());
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-123456), reader.readSLeb128());
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-2), reader.readZigZagLeb128());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(500), reader.readVInt());
+    CPPUNIT_ASSERT_EQUAL(vIntUnknownSize, reader.readVInt());
+    for(uint64 value : varInts) {
+        CPPUNIT_ASSERT_EQUAL(value, reader.readULeb128());
+    }
+    CPPUNIT_ASSERT(!reader.fail());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0), reader.readULeb128());
+    CPPUNIT_ASSERT(reader.fail());
+    const string varIntData(varIntStream.str());
+    // values split between chunks of the stream buffer (and read byte-wise from an unbuffered stream buffer)
+    for(const size_t chunkSize : {0u, 1u, 2u, 5u}) {
+        ChunkedStreamBuffer streamBuffer(varIntData, chunkSize);
+        istream chunkedStream(&streamBuffer);
+        BinaryReader chunkedReader(&chunkedStream);
+        Crc32 crc;
+        chunkedReader.setChecksum(&crc);
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(624485), chunkedReader.readULeb128());
+        CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-123456), chunkedReader.readSLeb128());
+        CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-2), chunkedReader.readZigZagLeb128());
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(500), chunkedReader.readVInt());
+        CPPUNIT_ASSERT_EQUAL(vIntUnknownSize, chunkedReader.readVInt());
+        for(uint64 value : varInts) {
+            CPPUNIT_ASSERT_EQUAL(value, chunkedReader.readULeb128());
+        }
+        CPPUNIT_ASSERT(chunkedStream.good());
+        CPPUNIT_ASSERT_EQUAL(Crc32::compute(varIntData.data(), varIntData.size()), crc.value());
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0), chunkedReader.readULeb128());
+        CPPUNIT_ASSERT(chunkedStream.fail());
+        CPPUNIT_ASSERT(chunkedStream.eof());
+    }
+    BufferReader bufferReader(varIntData.data(), varIntData.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(624485), bufferReader.readULeb128());
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-123456), bufferReader.readSLeb128());
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-2), bufferReader.readZigZagLeb128());
+    uint64 vInts[2];
+    bufferReader.readVInt(vInts, 2);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(500), vInts[0]);
+    CPPUNIT_ASSERT_EQUAL(vIntUnknownSize, vInts[1]);
+    uint64 decodedVarInts[5];
+    bufferReader.readULeb128(decodedVarInts, 5);
+    CPPUNIT_ASSERT(equal(varInts, varInts + 5, decodedVarInts));
+    CPPUNIT_ASSERT(!bufferReader.canRead());
+    bufferReader.seek(bufferReader.size() - 1);
+    try {
+        bufferReader.readULeb128(decodedVarInts, 2);
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+    CPPUNIT_ASSERT_EQUAL(bufferReader.size() - 1, bufferReader.offset());
+}
+
+/*!
+ * \brief Tests the BinaryWriter with write-combining buffer.
+ */
+void IoTests::testBufferedBinaryWriter()
+{
+    stringstream outputStream(ios_base::in | ios_base::out | ios_base::binary);
+    outputStream.exceptions(ios_base::failbit | ios_base::badbit);
+    outputStream.write("xy", 2);
+    {
+        BinaryWriter writer(&outputStream);
+        writer.setBufferSize(8);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), writer.bufferSize());
+
+        // small writes are buffered until the buffer is full
+        const auto lengthPosition = writer.position();
+        CPPUNIT_ASSERT(lengthPosition == 2);
+        writer.writeUInt16BE(0);
+        writer.writeUInt32BE(0x01020304u);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(6), writer.bufferedBytes());
+        CPPUNIT_ASSERT(outputStream.str() == "xy");
+
+        // patch length field while it is still buffered
+        writer.patchUInt16BE(lengthPosition, 4);
+        CPPUNIT_ASSERT(writer.position() == 8);
+
+        // writes exceeding the buffer cause it to be written
+        writer.writeUInt32LE(0x01020304u);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), writer.bufferedBytes());
+        CPPUNIT_ASSERT(outputStream.str() == string("xy\0\x04\x01\x02\x03\x04", 8));
+        writer.writeString("0123456789");
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), writer.bufferedBytes());
+        CPPUNIT_ASSERT(writer.position() == 22);
+
+        // patch length field which has already been written to the stream
+        writer.writeByte(0xFF);
+        writer.patchUInt16LE(lengthPosition, 0x0506);
+        CPPUNIT_ASSERT(outputStream.str() == string("xy\x06\x05\x01\x02\x03\x04\x04\x03\x02\x01" "0123456789\xFF", 23));
+
+        // remaining data is written when the writer is destroyed
+        writer.writeChar('!');
+    }
+    CPPUNIT_ASSERT(outputStream.str() == string("xy\x06\x05\x01\x02\x03\x04\x04\x03\x02\x01" "0123456789\xFF!", 24));
+
+    // buffered data is written before assigning another stream
+    stringstream otherStream(ios_base::in | ios_base::out | ios_base::binary);
+    BinaryWriter writer(&otherStream);
+    writer.setBufferSize(64);
+    writer.writeLengthPrefixedString("ABC");
+    CPPUNIT_ASSERT(otherStream.str().empty());
+    writer.setStream(&outputStream);
+    CPPUNIT_ASSERT(otherStream.str() == "\x83" "ABC");
+
+    // position is still correct after toggling buffering
+    stringstream patchStream(ios_base::in | ios_base::out | ios_base::binary);
+    patchStream.exceptions(ios_base::failbit | ios_base::badbit);
+    BinaryWriter patchWriter(&patchStream);
+    patchWriter.setBufferSize(64);
+    CPPUNIT_ASSERT(patchWriter.position() == 0);
+    patchWriter.writeUInt32BE(0);
+    patchWriter.setBufferSize(0);
+    patchWriter.writeString("0123456789");
+    patchWriter.setBufferSize(64);
+    const auto placeholderPosition = patchWriter.position();
+    CPPUNIT_ASSERT(placeholderPosition == 14);
+    patchWriter.writeUInt16BE(0);
+    patchWriter.writeChar('z');
+    patchWriter.patchUInt16BE(placeholderPosition, 0x0102);
+    patchWriter.patchUInt32BE(0, 0x41424344u);
+    CPPUNIT_ASSERT(patchWriter.position() == 17);
+    patchWriter.flush();
+    CPPUNIT_ASSERT(patchStream.str() == "ABCD0123456789\x01\x02z");
+
+    // position is still correct after repositioning the stream when nothing is buffered
+    patchStream.seekp(0);
+    CPPUNIT_ASSERT(patchWriter.position() == 0);
+    patchWriter.writeUInt16BE(0);
+    patchWriter.writeChar('!');
+    patchWriter.patchUInt16LE(0, 0x5958);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), patchWriter.bufferedBytes());
+    patchWriter.flush();
+    CPPUNIT_ASSERT(patchStream.str() == "XY!D0123456789\x01\x02z");
+}
+
+/*!
+ * \brief Tests the BufferReader.
+ */
+void IoTests::testBufferReader()
+{
+    // read test file into buffer
+    fstream testFile;
+    testFile.exceptions(ios_base::failbit | ios_base::badbit);
+    testFile.open(TestUtilities::testFilePath("some_data"), ios_base::in | ios_base::binary);
+    const string testData((istreambuf_iterator<char>(testFile)), istreambuf_iterator<char>());
+
+    // read values from buffer
+    BufferReader reader(testData.data(), testData.size());
+    CPPUNIT_ASSERT(reader.readUInt16LE() == 0x0102u);
+    CPPUNIT_ASSERT(reader.readUInt16BE() == 0x0102u);
+    CPPUNIT_ASSERT(reader.readUInt24LE() == 0x010203u);
+    CPPUNIT_ASSERT(reader.readUInt24BE() == 0x010203u);
+    CPPUNIT_ASSERT(reader.readUInt32LE() == 0x01020304u);
+    CPPUNIT_ASSERT(reader.readUInt32BE() == 0x01020304u);
+    CPPUNIT_ASSERT(reader.readUInt40LE() == 0x0102030405u);
+    CPPUNIT_ASSERT(reader.readUInt40BE() == 0x0102030405u);
+    CPPUNIT_ASSERT(reader.readUInt56LE() == 0x01020304050607u);
+    CPPUNIT_ASSERT(reader.readUInt56BE() == 0x01020304050607u);
+    CPPUNIT_ASSERT(reader.readUInt64LE() == 0x0102030405060708u);
+    CPPUNIT_ASSERT(reader.readUInt64BE() == 0x0102030405060708u);
+    reader.seek(0);
+    CPPUNIT_ASSERT(reader.readInt16LE() == 0x0102);
+    CPPUNIT_ASSERT(reader.readInt16BE() == 0x0102);
+    CPPUNIT_ASSERT(reader.readInt24LE() == 0x010203);
+    CPPUNIT_ASSERT(reader.readInt24BE() == 0x010203);
+    CPPUNIT_ASSERT(reader.readInt32LE() == 0x01020304);
+    CPPUNIT_ASSERT(reader.readInt32BE() == 0x01020304);
+    CPPUNIT_ASSERT(reader.readInt40LE() == 0x0102030405);
+    CPPUNIT_ASSERT(reader.readInt40BE() == 0x0102030405);
+    CPPUNIT_ASSERT(reader.readInt56LE() == 0x01020304050607);
+    CPPUNIT_ASSERT(reader.readInt56BE() == 0x01020304050607);
+    CPPUNIT_ASSERT(reader.readInt64LE() == 0x0102030405060708);
+    CPPUNIT_ASSERT(reader.readInt64BE() == 0x0102030405060708);
+    CPPUNIT_ASSERT(reader.readFloat32LE() == 1.125);
+    CPPUNIT_ASSERT(reader.readFloat64LE() == 1.625);
+    CPPUNIT_ASSERT(reader.readFloat32BE() == 1.125);
+    CPPUNIT_ASSERT(reader.readFloat64BE() == 1.625);
+    CPPUNIT_ASSERT(reader.readBool() == false);
+    CPPUNIT_ASSERT(reader.readBool() == true);
+    CPPUNIT_ASSERT(reader.readString(3) == "abc");
+    CPPUNIT_ASSERT(reader.readLengthPrefixedString() == "ABC");
+    CPPUNIT_ASSERT(reader.readTerminatedString() == "def");
+    CPPUNIT_ASSERT(!reader.canRead());
+    reader.seek(testData.size() - 11);
+    StringView view = reader.readStringView(3);
+    CPPUNIT_ASSERT_EQUAL(testData.data() + testData.size() - 11, view.first);
+    CPPUNIT_ASSERT_EQUAL(string("abc"), string(view.first, view.second));
+    reader.skip(4);
+    view = reader.readTerminatedStringView();
+    CPPUNIT_ASSERT_EQUAL(string("def"), string(view.first, view.second));
+    reader.seek(testData.size() - 4);
+    view = reader.readTerminatedStringView(static_cast<size_t>(2));
+    CPPUNIT_ASSERT_EQUAL(string("de"), string(view.first, view.second));
+    view = reader.readTerminatedStringView(static_cast<size_t>(5));
+    CPPUNIT_ASSERT_EQUAL(string("f"), string(view.first, view.second));
+    CPPUNIT_ASSERT(!reader.canRead());
+    reader.seek(testData.size() - 8);
+    reader.skipLengthPrefixedString();
+    string result;
+    reader.readTerminatedString(result);
+    CPPUNIT_ASSERT_EQUAL(string("def"), result);
+    reader.seek(testData.size() - 8);
+    reader.readLengthPrefixedString(result);
+    CPPUNIT_ASSERT_EQUAL(string("ABC"), result);
+    reader.readString(result, 2);
+    CPPUNIT_ASSERT_EQUAL(string("de"), result);
+    reader.seek(0);
+    uint16 uint16Values[2];
+    reader.readUInt16BE(uint16Values, 2);
+    CPPUNIT_ASSERT(uint16Values[0] == 0x0201u);
+    CPPUNIT_ASSERT(uint16Values[1] == 0x0102u);
+
+    // test signed values and bounds checks
+    const byte signedData[] = {0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0x00};
+    reader.reset(reinterpret_cast<const char *>(signedData), sizeof(signedData));
+    CPPUNIT_ASSERT(reader.readInt24BE() == -2);
+    CPPUNIT_ASSERT(reader.readInt24LE() == -2);
+    CPPUNIT_ASSERT(reader.bytesAvailable() == 1);
+    try {
+        reader.readUInt16BE();
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+    CPPUNIT_ASSERT(reader.offset() == 6);
+
+    // test multibyte-terminated strings
+    const char utf16Data[] = {'a', 0, 'b', 0, 0, 0, 'c', 0, 'd', 0};
+    reader.reset(utf16Data, sizeof(utf16Data));
+    CPPUNIT_ASSERT(reader.readMultibyteTerminatedStringLE() == string("a\0b\0", 4));
+    CPPUNIT_ASSERT(reader.readMultibyteTerminatedStringLE(static_cast<size_t>(4)) == string("c\0d\0", 4));
 }
 
 /*!
@@ -218,10 +689,224 @@ void IoTests::testBitReader()
     CPPUNIT_ASSERT(reader.readBit() == 0);
     try {
         reader.readBit();
+        CPPUNIT_FAIL("no exception");
     } catch(...) {
         catchIoFailure();
     }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), reader.bitsAvailable());
 
+    // read values crossing the boundaries of the internal cache and compare with values read bit by bit
+    byte data[77];
+    for(size_t i = 0; i != sizeof(data); ++i) {
+        data[i] = static_cast<byte>(i * 167 + 13);
+    }
+    BitReader bitwiseReader(reinterpret_cast<const char *>(data), sizeof(data));
+    reader.reset(reinterpret_cast<const char *>(data), sizeof(data));
+    CPPUNIT_ASSERT_EQUAL(sizeof(data) * 8, reader.bitsAvailable());
+    reader.align(); // must not skip anything when already aligned
+    for(byte bitCount = 1; reader.bitsAvailable() >= 64; bitCount = bitCount % 51 + 13) {
+        uint64 expected = 0;
+        for(byte i = 0; i != bitCount; ++i) {
+            expected = (expected << 1) | bitwiseReader.readBit();
+        }
+        CPPUNIT_ASSERT_EQUAL(expected, reader.showBits<uint64>(bitCount));
+        CPPUNIT_ASSERT_EQUAL(expected, reader.readBits<uint64>(bitCount));
+        CPPUNIT_ASSERT_EQUAL(bitwiseReader.bitsAvailable(), reader.bitsAvailable());
+    }
+    reader.reset(reinterpret_cast<const char *>(data), sizeof(data));
+    CPPUNIT_ASSERT_EQUAL(ConversionUtilities::BE::toUInt64(reinterpret_cast<const char *>(data)), reader.readBits<uint64>(64));
+    reader.skipBits(reader.bitsAvailable() - 3);
+    CPPUNIT_ASSERT(reader.readBits<byte>(3) == (data[sizeof(data) - 1] & 0x7));
+
+    // position is not altered when exceeding the end
+    reader.reset(reinterpret_cast<const char *>(testData), sizeof(testData));
+    reader.skipBits(67);
+    try {
+        reader.readBits<uint64>(6);
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+    try {
+        reader.skipBits(6);
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+    CPPUNIT_ASSERT(reader.readBits<byte>(5) == 0x00);
+
+    // exp-Golomb code with a prefix spanning multiple bytes
+    const byte longCode[] = {0x00, 0x00, 0x80, 0x00, 0x01};
+    reader.reset(reinterpret_cast<const char *>(longCode), sizeof(longCode));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0xFFFF), reader.readUnsignedExpGolombCodedBits<uint32>());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), reader.bitsAvailable());
+
+    // read LSB-first
+    LsbBitReader lsbReader(reinterpret_cast<const char *>(testData), sizeof(testData));
+    CPPUNIT_ASSERT(lsbReader.readBit() == 1);
+    CPPUNIT_ASSERT(lsbReader.readBits<byte>(7) == 0x40);
+    CPPUNIT_ASSERT(lsbReader.showBits<byte>(4) == 0x0);
+    lsbReader.skipBits(4);
+    CPPUNIT_ASSERT(lsbReader.readBits<uint32>(24) == 0x8443C9);
+    lsbReader.align();
+    CPPUNIT_ASSERT(lsbReader.readBits<uint16>(16) == 0x4400);
+    lsbReader.reset(reinterpret_cast<const char *>(data), sizeof(data));
+    CPPUNIT_ASSERT_EQUAL(ConversionUtilities::LE::toUInt64(reinterpret_cast<const char *>(data)), lsbReader.readBits<uint64>(64));
+    for(size_t bitIndex = 64, bitCount = 1; lsbReader.bitsAvailable() >= 64; bitIndex += bitCount, bitCount = bitCount % 51 + 13) {
+        uint64 expected = 0;
+        for(size_t i = 0; i != bitCount; ++i) {
+            expected |= static_cast<uint64>((data[(bitIndex + i) / 8] >> ((bitIndex + i) % 8)) & 1) << i;
+        }
+        CPPUNIT_ASSERT_EQUAL(expected, lsbReader.showBits<uint64>(static_cast<byte>(bitCount)));
+        CPPUNIT_ASSERT_EQUAL(expected, lsbReader.readBits<uint64>(static_cast<byte>(bitCount)));
+    }
+    lsbReader.skipBits(lsbReader.bitsAvailable() - 3);
+    CPPUNIT_ASSERT(lsbReader.readBits<byte>(3) == (data[sizeof(data) - 1] >> 5));
+    try {
+        lsbReader.readBit();
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+}
+
+/*!
+ * \brief Tests the BitWriter by reading the written data back via BitReader.
+ */
+void IoTests::testBitWriter()
+{
+    // write the data used in testBitReader()
+    vector<char> buffer;
+    BitWriter writer(buffer);
+    writer.writeBit(true);
+    writer.writeBits<byte>(0, 6);
+    writer.writeBits<byte>(3, 2);
+    writer.writeBits<uint32>(0x103C4428 << 1, 32);
+    writer.align();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(48), writer.bitsWritten());
+    writer.writeBits<byte>(0x44, 8);
+    writer.writeUnsignedExpGolombCodedBits<byte>(7);
+    writer.writeSignedExpGolombCodedBits<sbyte>(4);
+    writer.writeBits<byte>(0, 2);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), buffer.size()); // only whole words written before flushing
+    writer.flush();
+    const byte expectedData[] = {0x81, 0x90, 0x3C, 0x44, 0x28, 0x00, 0x44, 0x10, 0x20};
+    CPPUNIT_ASSERT_EQUAL(sizeof(expectedData), buffer.size());
+    CPPUNIT_ASSERT(equal(buffer.cbegin(), buffer.cend(), reinterpret_cast<const char *>(expectedData)));
+
+    // round trip with values of various lengths crossing the boundaries of the accumulator
+    buffer.clear();
+    writer.reset(buffer);
+    for(uint32 i = 0; i != 200; ++i) {
+        writer.writeBits<uint64>(i * 0x9E3779B97F4A7C15ul, static_cast<byte>(i % 64 + 1));
+        writer.writeUnsignedExpGolombCodedBits<uint32>(i * i * 1013);
+        writer.writeSignedExpGolombCodedBits<int32>(static_cast<int32>(i * 7919) * (i % 2 ? -1 : 1));
+        writer.writeBit(i % 3 == 0);
+    }
+    writer.writeUnsignedExpGolombCodedBits<uint64>(0xFFFFFFFFFFFFFFFEul);
+    writer.writeSignedExpGolombCodedBits<int64>(-0x7FFFFFFFFFFFFFFFl);
+    const size_t bitsWritten = writer.bitsWritten();
+    writer.flush();
+    CPPUNIT_ASSERT_EQUAL((bitsWritten + 7) / 8, buffer.size());
+    BitReader reader(buffer.data(), buffer.size());
+    for(uint32 i = 0; i != 200; ++i) {
+        const byte bitCount = static_cast<byte>(i % 64 + 1);
+        const uint64 expected = i * 0x9E3779B97F4A7C15ul;
+        CPPUNIT_ASSERT_EQUAL(bitCount < 64 ? expected & ((static_cast<uint64>(1) << bitCount) - 1) : expected, reader.readBits<uint64>(bitCount));
+        CPPUNIT_ASSERT_EQUAL(i * i * 1013, reader.readUnsignedExpGolombCodedBits<uint32>());
+        CPPUNIT_ASSERT_EQUAL(static_cast<int32>(i * 7919) * (i % 2 ? -1 : 1), reader.readSignedExpGolombCodedBits<int32>());
+        CPPUNIT_ASSERT_EQUAL(static_cast<byte>(i % 3 == 0), reader.readBit());
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0xFFFFFFFFFFFFFFFEul), reader.readUnsignedExpGolombCodedBits<uint64>());
+    CPPUNIT_ASSERT_EQUAL(static_cast<int64>(-0x7FFFFFFFFFFFFFFFl), reader.readSignedExpGolombCodedBits<int64>());
+    CPPUNIT_ASSERT(reader.bitsAvailable() < 8);
+
+    // fixed size buffer
+    char fixedBuffer[2];
+    writer.reset(fixedBuffer, sizeof(fixedBuffer));
+    writer.writeBits<uint16>(0xABCD, 16);
+    writer.flush();
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint16>(0xABCD), ConversionUtilities::BE::toUInt16(fixedBuffer));
+    writer.writeBit(true);
+    try {
+        writer.flush();
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+}
+
+/*!
+ * \brief Tests MappedFile and MappedFileBuffer.
+ */
+void IoTests::testMappedFile()
+{
+#ifdef PLATFORM_UNIX
+    // map the whole file
+    MappedFile file(TestUtilities::testFilePath("some_data"), MappingHint::Sequential);
+    CPPUNIT_ASSERT(file.isMapped());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(95), file.fileSize());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(95), file.size());
+    BufferReader reader(file.data(), file.size());
+    CPPUNIT_ASSERT(reader.readUInt16LE() == 0x0102u);
+    CPPUNIT_ASSERT(reader.readUInt16BE() == 0x0102u);
+    BitReader bitReader(file.data(), file.end());
+    CPPUNIT_ASSERT(bitReader.readBits<uint16>(16) == 0x0201u);
+
+    // map only a window which is not aligned to the page size
+    file.mapWindow(4, 6, MappingHint::Random);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(4), file.windowOffset());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(6), file.size());
+    reader.reset(file.data(), file.size());
+    CPPUNIT_ASSERT(reader.readUInt24LE() == 0x010203u);
+    CPPUNIT_ASSERT(reader.readUInt24BE() == 0x010203u);
+
+    // window exceeding the end of the file is truncated
+    file.mapWindow(90, 4096);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), file.size());
+    CPPUNIT_ASSERT(string(file.data(), file.size()) == string("Cdef\0", 5));
+
+    // use the mapping via std::istream
+    file.map();
+    MappedFileBuffer buffer(file);
+    istream stream(&buffer);
+    stream.exceptions(ios_base::failbit | ios_base::badbit);
+    BinaryReader binaryReader(&stream);
+    CPPUNIT_ASSERT(binaryReader.readStreamsize() == 95);
+    CPPUNIT_ASSERT(binaryReader.readUInt16LE() == 0x0102u);
+    stream.seekg(-4, ios_base::end);
+    CPPUNIT_ASSERT(binaryReader.readTerminatedString() == "def");
+
+    // use a mapping exceeding 4 GiB (the file is sparse so this does not take up disk space)
+    if(sizeof(void *) >= 8) {
+        const string largeFilePath = TestUtilities::workingCopyPath("some_data");
+        {
+            fstream largeFile(largeFilePath, ios_base::in | ios_base::out | ios_base::binary);
+            largeFile.exceptions(ios_base::failbit | ios_base::badbit);
+            largeFile.seekp(0x100000010ll);
+            largeFile.write("large\0file", 10);
+        }
+        MappedFile largeFile(largeFilePath, MappingHint::Random);
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0x10000001All), largeFile.fileSize());
+        MappedFileBuffer largeBuffer(largeFile);
+        istream largeStream(&largeBuffer);
+        largeStream.exceptions(ios_base::failbit | ios_base::badbit);
+        BinaryReader largeReader(&largeStream);
+        largeStream.seekg(0x100000010ll);
+        CPPUNIT_ASSERT_EQUAL(string("large"), largeReader.readTerminatedString());
+        CPPUNIT_ASSERT_EQUAL(static_cast<istream::pos_type>(0x100000016ll), largeStream.tellg());
+        CPPUNIT_ASSERT_EQUAL(string("file"), largeReader.readTerminatedString(static_cast<size_t>(4)));
+        CPPUNIT_ASSERT_EQUAL(static_cast<istream::pos_type>(0x10000001All), largeStream.tellg());
+    }
+
+    // error handling
+    try {
+        MappedFile("path/to/file/which/does/not/exist");
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+#endif
 }
 
 /*!
@@ -315,4 +1000,307 @@ void IoTests::testCopy()
     for(byte i = 0; i < 50; ++i) {
         CPPUNIT_ASSERT(testFile.get() == outputStream.get());
     }
+
+    // copy asynchronously
+    testFile.seekg(0);
+    outputStream.str(string());
+    vector<double> progress;
+    auto statistics = copyHelper.asyncCopy(testFile, outputStream, 95, [] { return false; }, [&progress] (double percentage) {
+        progress.push_back(percentage);
+    }, 3);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(95), statistics.bytesCopied);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), progress.size());
+    CPPUNIT_ASSERT(is_sorted(progress.cbegin(), progress.cend()));
+    CPPUNIT_ASSERT_EQUAL(1.0, progress.back());
+    testFile.seekg(0);
+    CPPUNIT_ASSERT(outputStream.str() == string(istreambuf_iterator<char>(testFile), istreambuf_iterator<char>()));
+
+    // abort asynchronous copying
+    testFile.seekg(0);
+    outputStream.str(string());
+    progress.clear();
+    statistics = copyHelper.asyncCopy(testFile, outputStream, 95, [&progress] { return progress.size() == 2; }, [&progress] (double percentage) {
+        progress.push_back(percentage);
+    });
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(39), statistics.bytesCopied);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(39), outputStream.str().size());
+
+    // read error is propagated
+    testFile.seekg(0);
+    try {
+        copyHelper.asyncCopy(testFile, outputStream, 96, [] { return false; }, [] (double) {});
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+    testFile.clear();
+
+#ifdef PLATFORM_UNIX
+    // copy between file descriptors
+    const int inputFd = ::open(TestUtilities::testFilePath("some_data").data(), O_RDONLY);
+    const string outputPath = TestUtilities::workingCopyPath("some_data");
+    const int outputFd = ::open(outputPath.data(), O_WRONLY | O_TRUNC);
+    CPPUNIT_ASSERT(inputFd != -1 && outputFd != -1);
+    CPPUNIT_ASSERT_EQUAL(static_cast<off_t>(5), lseek(inputFd, 5, SEEK_SET));
+    progress.clear();
+    copyHelper.callbackCopy(inputFd, outputFd, 50, [] { return false; }, [&progress] (double percentage) {
+        progress.push_back(percentage);
+    });
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), progress.size());
+    CPPUNIT_ASSERT_EQUAL(1.0, progress.back());
+    CPPUNIT_ASSERT_EQUAL(static_cast<off_t>(55), lseek(inputFd, 0, SEEK_CUR));
+    CPPUNIT_ASSERT_EQUAL(static_cast<off_t>(50), lseek(outputFd, 0, SEEK_CUR));
+
+    // copy from a pipe
+    int pipeFds[2];
+    CPPUNIT_ASSERT_EQUAL(0, pipe(pipeFds));
+    CPPUNIT_ASSERT_EQUAL(static_cast<ssize_t>(4), write(pipeFds[1], "pipe", 4));
+    copyHelper.copy(pipeFds[0], outputFd, 4);
+
+    // exceeding the end of the input
+    try {
+        copyHelper.copy(inputFd, outputFd, 41);
+        CPPUNIT_FAIL("no exception");
+    } catch(...) {
+        catchIoFailure();
+    }
+    ::close(pipeFds[0]);
+    ::close(pipeFds[1]);
+    ::close(inputFd);
+    ::close(outputFd);
+
+    // check output
+    ifstream outputFile;
+    outputFile.exceptions(ios_base::failbit | ios_base::badbit);
+    outputFile.open(outputPath, ios_base::in | ios_base::binary);
+    testFile.seekg(5);
+    for(byte i = 0; i < 50; ++i) {
+        CPPUNIT_ASSERT(testFile.get() == outputFile.get());
+    }
+    char pipeData[4];
+    outputFile.read(pipeData, 4);
+    CPPUNIT_ASSERT(string(pipeData, 4) == "pipe");
+    for(byte i = 0; i < 40; ++i) {
+        CPPUNIT_ASSERT(testFile.get() == outputFile.get());
+    }
+    CPPUNIT_ASSERT(outputFile.peek() == char_traits<char>::eof());
+#endif
+}
+
+/*!
+ * \brief Tests Crc32 and the CRC-32 functions of BinaryReader.
+ */
+void IoTests::testCrc32()
+{
+    // compare with the CRC computed byte-wise for various lengths and offsets (to cover all code paths)
+    vector<char> data(0x1000);
+    for(size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<char>(i * 251 + (i >> 8));
+    }
+    for(size_t offset = 0; offset != 3; ++offset) {
+        uint32 expectedCrc = 0;
+        for(size_t length = 0, previousLength = 0; length + offset <= data.size(); previousLength = length, length += (length < 300 ? 1 : 97)) {
+            for(size_t i = offset + previousLength; i != offset + length; ++i) {
+                expectedCrc = (expectedCrc << 8) ^ BinaryReader::crc32Table[(expectedCrc >> 24) ^ static_cast<byte>(data[i])];
+            }
+            CPPUNIT_ASSERT_EQUAL(expectedCrc, Crc32::compute(data.data() + offset, length));
+        }
+    }
+
+    // compute incrementally
+    const uint32 expectedCrc = Crc32::compute(data.data(), data.size());
+    Crc32 crc;
+    for(size_t i = 0, chunkSize = 1; i < data.size(); i += chunkSize, chunkSize = chunkSize * 3 + 1) {
+        crc.update(data.data() + i, min(chunkSize, data.size() - i));
+    }
+    CPPUNIT_ASSERT_EQUAL(expectedCrc, crc.value());
+    crc.reset();
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0), crc.value());
+
+    // read CRC from stream
+    stringstream stream(string(data.data(), data.size()), ios_base::in | ios_base::binary);
+    BinaryReader reader(&stream);
+    CPPUNIT_ASSERT_EQUAL(expectedCrc, reader.readCrc32(data.size()));
+    CPPUNIT_ASSERT_EQUAL(expectedCrc, BinaryReader::computeCrc32(data.data(), data.size()));
+
+    // compute while copying
+    stream.seekg(0);
+    stringstream outputStream(ios_base::in | ios_base::out | ios_base::binary);
+    CopyHelper<100> copyHelper;
+    copyHelper.checksumCopy(stream, outputStream, data.size(), crc);
+    CPPUNIT_ASSERT_EQUAL(expectedCrc, crc.value());
+    CPPUNIT_ASSERT_EQUAL(data.size(), outputStream.str().size());
+}
+
+/*!
+ * \brief Tests Crc32C, Crc16, Crc8, Adler32 and the checksum hooks of BinaryReader and BinaryWriter.
+ */
+void IoTests::testChecksums()
+{
+    // check values
+    const char *const checkInput = "123456789";
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0x89A1897F), Crc32::compute(checkInput, 9));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0x0376E6E7), Crc32::compute(checkInput, 9, 0xFFFFFFFF)); // MPEG-2
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0xE3069283), Crc32C::compute(checkInput, 9));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint16>(0xFEE8), Crc16::compute(checkInput, 9)); // FLAC
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint16>(0xAEE7), Crc16::compute(checkInput, 9, 0xFFFF)); // MPEG audio
+    CPPUNIT_ASSERT_EQUAL(static_cast<byte>(0xF4), Crc8::compute(checkInput, 9));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0x091E01DE), Adler32::compute(checkInput, 9));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(1), Adler32::compute(checkInput, 0));
+
+    // compare with the checksums computed bit-wise for various lengths and offsets (to cover all code paths)
+    vector<char> data(0x4000, static_cast<char>(0xFF));
+    for(size_t i = 0; i != 0x1000; ++i) {
+        data[i] = static_cast<char>(i * 251 + (i >> 8));
+    }
+    for(size_t offset = 0; offset != 3; ++offset) {
+        uint32 expectedCrc32C = 0xFFFFFFFF, expectedAdlerA = 1, expectedAdlerB = 0;
+        uint16 expectedCrc16 = 0;
+        for(size_t length = 0, previousLength = 0; length + offset <= data.size(); previousLength = length, length += (length < 300 ? 1 : 997)) {
+            for(size_t i = offset + previousLength; i != offset + length; ++i) {
+                const byte value = static_cast<byte>(data[i]);
+                expectedCrc32C ^= value;
+                for(int bit = 0; bit != 8; ++bit) {
+                    expectedCrc32C = (expectedCrc32C & 1) ? (expectedCrc32C >> 1) ^ 0x82F63B78 : expectedCrc32C >> 1;
+                }
+                expectedCrc16 ^= static_cast<uint16>(value << 8);
+                for(int bit = 0; bit != 8; ++bit) {
+                    expectedCrc16 = static_cast<uint16>((expectedCrc16 & 0x8000) ? (expectedCrc16 << 1) ^ 0x8005 : expectedCrc16 << 1);
+                }
+                expectedAdlerA = (expectedAdlerA + value) % 65521;
+                expectedAdlerB = (expectedAdlerB + expectedAdlerA) % 65521;
+            }
+            CPPUNIT_ASSERT_EQUAL(~expectedCrc32C, Crc32C::compute(data.data() + offset, length));
+            CPPUNIT_ASSERT_EQUAL(expectedCrc16, Crc16::compute(data.data() + offset, length));
+            CPPUNIT_ASSERT_EQUAL((expectedAdlerB << 16) | expectedAdlerA, Adler32::compute(data.data() + offset, length));
+        }
+    }
+
+    // compute incrementally via the common interface
+    Crc32C crc32C;
+    Crc16 crc16(0xFFFF);
+    Crc8 crc8;
+    Adler32 adler32;
+    Checksum *const checksums[] = { &crc32C, &crc16, &crc8, &adler32 };
+    for(Checksum *checksum : checksums) {
+        for(size_t i = 0, chunkSize = 1; i < data.size(); i += chunkSize, chunkSize = chunkSize * 3 + 1) {
+            checksum->update(data.data() + i, min(chunkSize, data.size() - i));
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(Crc32C::compute(data.data(), data.size()), crc32C.value());
+    CPPUNIT_ASSERT_EQUAL(Crc16::compute(data.data(), data.size(), 0xFFFF), crc16.value());
+    CPPUNIT_ASSERT_EQUAL(Crc8::compute(data.data(), data.size()), crc8.value());
+    CPPUNIT_ASSERT_EQUAL(Adler32::compute(data.data(), data.size()), adler32.value());
+    adler32.reset();
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(1), adler32.value());
+
+    // compute as side effect of writing
+    stringstream stream(ios_base::in | ios_base::out | ios_base::binary);
+    BinaryWriter writer(&stream);
+    writer.setBufferSize(16);
+    writer.writeUInt16BE(0xFFF8);
+    crc32C.reset();
+    writer.setChecksum(&crc32C);
+    CPPUNIT_ASSERT_EQUAL(static_cast<Checksum *>(&crc32C), writer.checksum());
+    writer.writeUInt32LE(0x12345678);
+    writer.writeLengthPrefixedString("checksum");
+    writer.write(data.data(), 1000);
+    writer.setChecksum(nullptr);
+    writer.writeUInt32BE(crc32C.value());
+    writer.flush();
+    const string written = stream.str();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2 + 4 + 9 + 1000 + 4), written.size());
+    CPPUNIT_ASSERT_EQUAL(Crc32C::compute(written.data() + 2, 4 + 9 + 1000), crc32C.value());
+
+    // compute as side effect of reading
+    BinaryReader reader(&stream);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint16>(0xFFF8), reader.readUInt16BE());
+    crc16.reset();
+    reader.setChecksum(&crc16);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32>(0x12345678), reader.readUInt32LE());
+    CPPUNIT_ASSERT_EQUAL(string("checksum"), reader.readLengthPrefixedString());
+    vector<char> buffer;
+    reader.read(buffer, 1000);
+    reader.setChecksum(nullptr);
+    CPPUNIT_ASSERT_EQUAL(Crc32C::compute(written.data() + 2, 4 + 9 + 1000), reader.readUInt32BE());
+    CPPUNIT_ASSERT_EQUAL(Crc16::compute(written.data() + 2, 4 + 9 + 1000), crc16.value());
+}
+
+/*!
+ * \brief Tests MonotonicArena, FixedSizePool and reading into the arena via BinaryReader.
+ */
+void IoTests::testArena()
+{
+    // allocate small and large chunks of memory within the arena
+    MonotonicArena arena(0x400);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), arena.bytesReserved());
+    char *const first = static_cast<char *>(arena.allocate(3, 1));
+    auto *const second = arena.create<uint64>(0x0123456789ABCDEFul);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uintptr_t>(0), reinterpret_cast<uintptr_t>(second) % alignof(uint64));
+    CPPUNIT_ASSERT(reinterpret_cast<char *>(second) >= first + 3);
+    CPPUNIT_ASSERT(reinterpret_cast<char *>(second) < first + 3 + alignof(uint64));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0x400), arena.bytesReserved());
+    char *const large = static_cast<char *>(arena.allocate(0x1000));
+    fill(large, large + 0x1000, 'x');
+    CPPUNIT_ASSERT(arena.bytesReserved() > 0x1400);
+    char *const third = static_cast<char *>(arena.allocate(1, 1));
+    CPPUNIT_ASSERT_EQUAL(reinterpret_cast<char *>(second + 1), third);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3 + 8 + 0x1000 + 1), arena.bytesAllocated());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64>(0x0123456789ABCDEFul), *second);
+    for(int i = 0; i != 10; ++i) {
+        arena.allocate(0x80);
+    }
+    CPPUNIT_ASSERT(arena.bytesReserved() > 0x1800);
+    arena.release();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), arena.bytesReserved());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), arena.bytesAllocated());
+
+    // reuse blocks of the pool
+    FixedSizePool pool(20, 2);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), pool.blockSize() % alignof(max_align_t));
+    CPPUNIT_ASSERT(pool.blockSize() >= 20);
+    void *const blocks[] = { pool.allocate(), pool.allocate(), pool.allocate() };
+    CPPUNIT_ASSERT_EQUAL(static_cast<char *>(blocks[0]) + pool.blockSize(), static_cast<char *>(blocks[1]));
+    CPPUNIT_ASSERT(blocks[2] != blocks[0] && blocks[2] != blocks[1]);
+    pool.deallocate(blocks[1]);
+    pool.deallocate(nullptr);
+    CPPUNIT_ASSERT_EQUAL(blocks[1], pool.allocate());
+    pool.release();
+
+    // read strings and buffers into the arena
+    string data("\x8Fshort string of");
+    data.append(1, '\x80' | 40);
+    data.append(40, 'a');
+    data.append("terminated string which is long enough to be not stored inline");
+    data.append(1, '\0');
+    data.append("\0m\0u\0l\0t\0i\0\0", 12);
+    data.append("buffer");
+    stringstream stream(data, ios_base::in | ios_base::binary);
+    BinaryReader reader(&stream);
+    {
+        ArenaVector<ArenaString> strings{ArenaAllocator<ArenaString>(arena)};
+        strings.reserve(4);
+        ArenaString string{ArenaAllocator<char>(arena)};
+        reader.readLengthPrefixedString(string);
+        strings.push_back(string);
+        reader.readLengthPrefixedString(string);
+        strings.push_back(string);
+        reader.readTerminatedString(string);
+        strings.push_back(string);
+        reader.readMultibyteTerminatedStringBE(string);
+        strings.push_back(string);
+        ArenaVector<char> buffer{ArenaAllocator<char>(arena)};
+        reader.read(buffer, 6);
+        CPPUNIT_ASSERT(!stream.fail());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), strings.size());
+        CPPUNIT_ASSERT_EQUAL(std::string("short string of"), std::string(strings[0].data(), strings[0].size()));
+        CPPUNIT_ASSERT_EQUAL(std::string(40, 'a'), std::string(strings[1].data(), strings[1].size()));
+        CPPUNIT_ASSERT_EQUAL(std::string("terminated string which is long enough to be not stored inline"), std::string(strings[2].data(), strings[2].size()));
+        CPPUNIT_ASSERT_EQUAL(std::string("\0m\0u\0l\0t\0i", 10), std::string(strings[3].data(), strings[3].size()));
+        CPPUNIT_ASSERT_EQUAL(std::string("buffer"), std::string(buffer.data(), buffer.size()));
+        CPPUNIT_ASSERT(strings.get_allocator() == buffer.get_allocator());
+        CPPUNIT_ASSERT(strings[2].get_allocator() == string.get_allocator());
+        CPPUNIT_ASSERT(arena.bytesAllocated() >= 40 + 63 + 6);
+    }
+    arena.release();
 }